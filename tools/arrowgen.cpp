@@ -0,0 +1,149 @@
+// Rasterizes the wind arrow for every compass sector and prints the
+// sprites as weather_tiny/wind_arrows.h, so the device draws the arrow
+// without any trigonometry.
+//
+// Build and run on the host from the repository root:
+//   g++ -std=c++11 -I weather_tiny tools/arrowgen.cpp -o arrowgen
+//   ./arrowgen > weather_tiny/wind_arrows.h
+//
+// Each sprite is a RotatedGlyph with its offsets taken from the arrow
+// center, stored column by column like the glyphs of tools/fontgen.py.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <vector>
+#include "framebuffer.h"
+
+// (scale, generated sprite set name), only the sizes the screen draws
+const struct { int scale; const char* name; } ARROWS[] = {
+    { 4, "wind_arrow4" },
+};
+
+// defined for the sketch only in the generated header, as WIND_ARROW_SECTORS
+const int SECTORS = 36;  // 10 degrees each
+const int CANVAS = 64;
+const int CENTER = CANVAS / 2;
+
+
+// The arrow as two triangles around its center (3, 3), pointing down
+// at 0 degrees, turned clockwise by alpha.
+struct WindArrow {
+    int scale = 1;
+    int offset = -3;
+    float deg2rad = 0.01745;
+
+    float x0 = 1 +offset, y0 = 0 +offset;  // top left
+    float x1 = 3 +offset, y1 = 2 +offset;  // bottom
+    float x2 = 3 +offset, y2 = 6 +offset;  // top
+    float x3 = 5 +offset, y3 = 0 +offset;  // top right
+
+    void rotate(int alpha) {
+        float rad = alpha * deg2rad;
+        _rotate_point(rad, &x0, &y0);
+        _rotate_point(rad, &x1, &y1);
+        _rotate_point(rad, &x2, &y2);
+        _rotate_point(rad, &x3, &y3);
+    }
+
+    template<typename Frame>
+    void draw(int x, int y, Frame& frame) {
+        frame.fill_triangle(x+x0*scale, y+y0*scale, x+x1*scale, y+y1*scale, x+x2*scale, y+y2*scale);
+        frame.fill_triangle(x+x1*scale, y+y1*scale, x+x2*scale, y+y2*scale, x+x3*scale, y+y3*scale);
+    }
+
+
+    private:
+
+    void _rotate_point(float rad, float *x, float *y) {
+        float xc = *x;
+        float yc = *y;
+        *x = cos(rad) * xc - sin(rad) * yc;
+        *y = sin(rad) * xc + cos(rad) * yc;
+    }
+} ;
+
+
+void convert(int scale, const char* name) {
+    std::vector<int> bitmap;
+    std::vector<RotatedGlyph> sprites;
+    int radius = 0;
+
+    for (int sector = 0; sector < SECTORS; sector++) {
+        static FrameBuffer<CANVAS, CANVAS> canvas;
+        canvas.clear();
+        WindArrow arrow;
+        arrow.scale = scale;
+        arrow.rotate(sector * 360 / SECTORS);
+        arrow.draw(CENTER, CENTER, canvas);
+
+        int x_min = CANVAS, x_max = -1, y_min = CANVAS, y_max = -1;
+        for (int y = 0; y < CANVAS; y++) {
+            for (int x = 0; x < CANVAS; x++) {
+                if (canvas.get_pixel(x, y)) {
+                    if (x < x_min) x_min = x;
+                    if (x > x_max) x_max = x;
+                    if (y < y_min) y_min = y;
+                    if (y > y_max) y_max = y;
+                }
+            }
+        }
+        if (y_max - y_min + 1 > MAX_GLYPH_HEIGHT) {
+            fprintf(stderr, "%s: arrow %d rows tall, FrameBuffer draws sprites up to %d rows\n",
+                name, y_max - y_min + 1, MAX_GLYPH_HEIGHT);
+            exit(1);
+        }
+        RotatedGlyph sprite = {
+            (uint16_t) bitmap.size(), (uint8_t) (x_max - x_min + 1), (uint8_t) (y_max - y_min + 1),
+            0, (int8_t) (x_min - CENTER), (int8_t) (y_min - CENTER)
+        };
+        for (int x = x_min; x <= x_max; x++) {
+            for (int y0 = y_min; y0 <= y_max; y0 += 8) {
+                int byte = 0;
+                for (int y = y0; y < y0 + 8 && y <= y_max; y++) {
+                    byte |= canvas.get_pixel(x, y) << (7 - (y - y0));
+                }
+                bitmap.push_back(byte);
+            }
+        }
+        sprites.push_back(sprite);
+        radius = std::max(radius, std::max(std::max(CENTER - x_min, x_max - CENTER), std::max(CENTER - y_min, y_max - CENTER)));
+    }
+
+    printf("// %s, arrow at scale %d\n", name, scale);
+    printf("const uint8_t %s_bitmap[] PROGMEM = {\n", name);
+    for (size_t i = 0; i < bitmap.size(); i += 12) {
+        printf(" ");
+        for (size_t j = i; j < i + 12 && j < bitmap.size(); j++) {
+            printf(" 0x%02X,", bitmap[j]);
+        }
+        printf("\n");
+    }
+    printf("};\n\n");
+    printf("const RotatedGlyph %s_glyphs[] PROGMEM = {\n", name);
+    for (int i = 0; i < SECTORS; i++) {
+        const RotatedGlyph& g = sprites[i];
+        printf("  { %5d, %3d, %3d, %3d, %3d, %4d },  // %d deg\n",
+            g.offset, g.width, g.height, g.x_advance, g.x_offset, g.y_offset, i * 360 / SECTORS);
+    }
+    printf("};\n\n");
+    printf("const RotatedFont %s PROGMEM = { %s_bitmap, %s_glyphs, 0, %d, 0 };\n\n",
+        name, name, name, SECTORS - 1);
+    printf("// farthest pixel from the arrow center in any sector\n");
+    printf("constexpr int %s_radius = %d;\n\n\n", name, radius);
+}
+
+
+int main() {
+    printf("// Generated by tools/arrowgen.cpp, do not edit.\n");
+    printf("#ifndef _wind_arrows_h\n");
+    printf("#define _wind_arrows_h\n\n");
+    printf("#include \"framebuffer.h\"\n\n");
+    printf("#define WIND_ARROW_SECTORS %d\n\n\n", SECTORS);
+    for (const auto& arrow : ARROWS) {
+        convert(arrow.scale, arrow.name);
+    }
+    printf("#endif\n");
+    return 0;
+}
@@ -0,0 +1,49 @@
+// Rasterizes the static part of the weather screen (render_chrome) into
+// the frame buffer layout and prints it as weather_tiny/chrome_bitmap.h.
+//
+// Build and run on the host from the repository root:
+//   g++ -std=c++11 -I tools/host -I weather_tiny tools/chromegen.cpp -o chromegen
+//   ./chromegen > weather_tiny/chrome_bitmap.h
+//
+// For another panel add -DSCREEN_WIDTH=.. -DSCREEN_HEIGHT=.. as set in the sketch.
+
+#include <stdio.h>
+#include "Arduino.h"
+
+String openweather_icons[9];
+
+#ifndef SCREEN_WIDTH
+#define SCREEN_WIDTH   250
+#define SCREEN_HEIGHT  122
+#endif
+
+#include "render.h"
+
+
+int main() {
+    static ScreenFrame frame;
+    frame.clear();
+    render_chrome(frame);
+
+    const uint8_t* bitmap = frame.buffer();
+    printf("// Generated by tools/chromegen.cpp, do not edit.\n");
+    printf("#ifndef _chrome_bitmap_h\n");
+    printf("#define _chrome_bitmap_h\n\n");
+    printf("#include \"render.h\"\n\n");
+    printf("#define CHROME_SCREEN_WIDTH %d\n", SCREEN_WIDTH);
+    printf("#define CHROME_SCREEN_HEIGHT %d\n\n", SCREEN_HEIGHT);
+    printf("static_assert(CHROME_SCREEN_WIDTH == SCREEN_WIDTH && CHROME_SCREEN_HEIGHT == SCREEN_HEIGHT, "
+           "\"chrome bitmap generated for another screen size\");\n\n");
+    printf("// render_chrome in the frame buffer layout, %d bytes\n", ScreenFrame::SIZE);
+    printf("const uint8_t chrome_bitmap[ScreenFrame::SIZE] PROGMEM = {\n");
+    for (int i = 0; i < ScreenFrame::SIZE; i += ScreenFrame::ROW_BYTES) {
+        printf(" ");
+        for (int j = i; j < i + ScreenFrame::ROW_BYTES; j++) {
+            printf(" 0x%02X,", bitmap[j]);
+        }
+        printf("\n");
+    }
+    printf("};\n\n");
+    printf("#endif\n");
+    return 0;
+}
@@ -0,0 +1,219 @@
+// Runs the api host cache of weather_tiny/dns_cache.h on a Linux host:
+// answers kept for DNS_CACHE_TTL_SEC, forgotten after a failed connect,
+// the entry expiring first evicted when the cache is full. dns_resolve_all
+// sends the cache misses to a stand-in lwip resolver (tools/host/lwip/dns.h)
+// answering some hosts only after the lookup timed out, time is a clock the
+// test moves forward instead of wakes from deep sleep.
+//
+// Build and run from the repository root:
+//   g++ -std=c++11 -O2 -I tools/host -I weather_tiny tools/dns_cache_host.cpp -o dns_cache_host
+//   ./dns_cache_host
+
+#include <time.h>
+#include <string>
+#include <vector>
+#include "Arduino.h"
+#include "WiFi.h"
+#include "lwip/dns.h"
+
+
+static time_t host_now = 1700000000;
+
+time_t host_time(time_t* t) {
+    if (t != NULL) {
+        *t = host_now;
+    }
+    return host_now;
+}
+
+// the cache reads the clock with time(NULL)
+#define time(t) host_time(t)
+#include "dns_cache.h"
+#include "dns_resolve.h"
+#undef time
+
+
+static int failed_cnt = 0;
+
+
+void check(bool ok, const std::string& name) {
+    printf("%-52s %s\n", name.c_str(), ok ? "ok" : "FAILED");
+    failed_cnt += !ok;
+}
+
+
+void resolve_all(const char** hosts, const int host_cnt) {
+    host_dns_queried.clear();
+    dns_resolve_all(hosts, host_cnt, DNS_TIMEOUT_MS);
+}
+
+
+bool cached_ip_is(const char* host, uint32_t expected) {
+    uint32_t ip = 0;
+    return dns_cache_get(host, ip) && ip == expected;
+}
+
+
+bool is_cached(const char* host) {
+    uint32_t ip;
+    return dns_cache_get(host, ip);
+}
+
+
+void clear_cache() {
+    memset(dns_cache, 0, sizeof(dns_cache));
+}
+
+
+void test_get_put() {
+    clear_cache();
+    check(!is_cached("api.openweathermap.org"), "empty cache misses");
+
+    dns_cache_put("api.openweathermap.org", 0x0100000a);
+    check(cached_ip_is("api.openweathermap.org", 0x0100000a), "put then get");
+    check(!is_cached("api.waqi.info"), "other host misses");
+
+    dns_cache_put("api.openweathermap.org", 0x0200000a);
+    int entry_cnt = 0;
+    for (int i = 0; i < DNS_CACHE_SIZE; i++) {
+        entry_cnt += strcmp(dns_cache[i].host, "api.openweathermap.org") == 0;
+    }
+    check(cached_ip_is("api.openweathermap.org", 0x0200000a) && entry_cnt == 1, "put of a cached host replaces its entry");
+
+    dns_cache_put("api.waqi.info", 0);
+    check(!is_cached("api.waqi.info"), "zero address is a miss");
+
+    char long_host[DNS_HOST_SIZE + 1];
+    memset(long_host, 'a', DNS_HOST_SIZE);
+    long_host[DNS_HOST_SIZE] = '\0';
+    dns_cache_put(long_host, 0x0300000a);
+    check(!is_cached(long_host) && cached_ip_is("api.openweathermap.org", 0x0200000a),
+        "host longer than an entry is not cached");
+}
+
+
+void test_expiry() {
+    clear_cache();
+    dns_cache_put("api.openweathermap.org", 0x0100000a);
+
+    host_now += DNS_CACHE_TTL_SEC - 1;
+    check(is_cached("api.openweathermap.org"), "valid until the ttl");
+    host_now += 1;
+    check(!is_cached("api.openweathermap.org"), "expired at the ttl");
+
+    dns_cache_put("api.openweathermap.org", 0x0100000a);
+    dns_cache_forget("api.openweathermap.org");
+    check(!is_cached("api.openweathermap.org"), "forgotten host misses");
+    dns_cache_forget("api.waqi.info");  // not cached, nothing to do
+
+    dns_cache_put("api.openweathermap.org", 0x0100000a);
+    check(cached_ip_is("api.openweathermap.org", 0x0100000a), "forgotten host cached again");
+}
+
+
+void test_eviction() {
+    clear_cache();
+    char hosts[DNS_CACHE_SIZE + 1][DNS_HOST_SIZE];
+
+    for (int i = 0; i <= DNS_CACHE_SIZE; i++) {
+        sprintf(hosts[i], "host%d.example", i);
+    }
+    for (int i = 0; i < DNS_CACHE_SIZE; i++) {
+        dns_cache_put(hosts[i], 0x0100000a + i);
+        host_now += 60;
+    }
+    // host1 refreshed, host0 now expires first even with host1 put before it
+    dns_cache_put(hosts[1], 0x0100000a + 1);
+    dns_cache_put(hosts[DNS_CACHE_SIZE], 0x0100000a + DNS_CACHE_SIZE);
+
+    bool others_kept = true;
+    for (int i = 1; i <= DNS_CACHE_SIZE; i++) {
+        others_kept = others_kept && cached_ip_is(hosts[i], 0x0100000a + i);
+    }
+    check(!is_cached(hosts[0]) && others_kept, "full cache evicts the entry expiring first");
+
+    dns_cache_forget(hosts[3]);
+    dns_cache_put("api.waqi.info", 0x0900000a);
+    check(!is_cached(hosts[3]) && cached_ip_is(hosts[2], 0x0100000a + 2) && cached_ip_is("api.waqi.info", 0x0900000a),
+        "forgotten entry evicted before valid ones");
+}
+
+
+void test_resolve_all() {
+    clear_cache();
+    host_dns_answers["api.openweathermap.org"] = 0x0100000a;
+    host_dns_answers["api.waqi.info"] = 0x0200000a;
+    const char* hosts[] = { "api.openweathermap.org", "api.waqi.info", "unknown.example" };
+
+    resolve_all(hosts, 3);
+    check(host_dns_queried.size() == 3 && cached_ip_is("api.openweathermap.org", 0x0100000a)
+        && cached_ip_is("api.waqi.info", 0x0200000a) && !is_cached("unknown.example"), "first wake looks up every host");
+    check(host_dns_unlocked_cnt == 0, "queries sent from the tcpip thread");
+
+    host_now += SLEEP_INTERVAL_MIN * 60;
+    resolve_all(hosts, 3);
+    check(host_dns_queried == std::vector<std::string>{ "unknown.example" }, "next wake looks up only the unanswered host");
+
+    dns_cache_forget("api.waqi.info");
+    resolve_all(hosts, 2);
+    check(host_dns_queried == std::vector<std::string>{ "api.waqi.info" }, "failed connect looks the host up again");
+
+    host_now += DNS_CACHE_TTL_SEC;
+    resolve_all(hosts, 2);
+    check(host_dns_queried.size() == 2, "wake after the ttl looks up every host");
+
+    const char* many[DNS_CACHE_SIZE + 2];
+    char names[DNS_CACHE_SIZE + 2][DNS_HOST_SIZE];
+    for (int i = 0; i < DNS_CACHE_SIZE + 2; i++) {
+        sprintf(names[i], "host%d.example", i);
+        many[i] = names[i];
+    }
+    const char* missing[DNS_CACHE_SIZE];
+    clear_cache();
+    check(dns_cache_misses(many, DNS_CACHE_SIZE + 2, missing, DNS_CACHE_SIZE) == DNS_CACHE_SIZE,
+        "misses bounded by the lookup slots");
+}
+
+
+// two locations fetched in one wake, waqi answers the first lookup only
+// once the second one runs, its slot then taken by openweathermap
+void test_late_answer() {
+    clear_cache();
+    host_dns_answers["api.openweathermap.org"] = 0x0100000a;
+    host_dns_answers["api.waqi.info"] = 0x0200000a;
+    const char* hosts[] = { "api.openweathermap.org", "api.waqi.info" };
+
+    dns_cache_put("api.openweathermap.org", 0x0100000a);
+    host_dns_slow.insert("api.waqi.info");
+    resolve_all(hosts, 2);
+    check(!is_cached("api.waqi.info"), "host answering after the timeout not cached");
+
+    dns_cache_forget("api.openweathermap.org");
+    host_dns_slow.clear();
+    host_dns_slow.insert("api.openweathermap.org");
+    resolve_all(hosts, 2);
+    check(!is_cached("api.openweathermap.org") && cached_ip_is("api.waqi.info", 0x0200000a),
+        "late answer of an earlier lookup dropped");
+
+    host_dns_slow.clear();
+    resolve_all(hosts, 2);
+    check(cached_ip_is("api.openweathermap.org", 0x0100000a) && cached_ip_is("api.waqi.info", 0x0200000a),
+        "host looked up again after a dropped answer");
+    host_dns_queries.clear();
+}
+
+
+int main() {
+    test_get_put();
+    test_expiry();
+    test_eviction();
+    host_event_wait_hook = host_dns_answer_due;
+    test_resolve_all();
+    test_late_answer();
+
+    if (failed_cnt > 0) {
+        printf("%d checks failed\n", failed_cnt);
+        return 1;
+    }
+    return 0;
+}
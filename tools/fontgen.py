@@ -0,0 +1,225 @@
+#!/usr/bin/env python3
+"""Converts Adafruit GFX fonts to the column-major layout blitted by FrameBuffer.
+
+Usage: python3 tools/fontgen.py > weather_tiny/rotated_fonts.h
+       python3 tools/fontgen.py --gfx > weather_tiny/gfx_fonts.h
+
+Each glyph is stored column by column, left to right. A column holds
+ceil(height / 8) bytes with the top row in the most significant bit.
+With the panel rotated, a glyph column lands on one native row of the
+frame buffer.
+
+Fonts keep only the glyphs of the characters they are drawn with (see
+the manifest below). The glyph table still spans first..last of those
+characters so a glyph is looked up by index, left out glyphs are empty.
+With --gfx the GxEPD screens' fonts are subset the same way and written
+in the GFXfont layout.
+"""
+
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+FONT_DIR = os.path.join(ROOT, 'libraries', 'Adafruit_GFX_Library', 'Fonts')
+FRAMEBUFFER_H = os.path.join(ROOT, 'weather_tiny', 'framebuffer.h')
+
+ASCII = ''.join(chr(c) for c in range(0x20, 0x7F))
+NUMBERS = ' -0123456789'
+METEO_ICONS = ')BHNYQROWL'  # meteo_font in view.h
+
+# Characters each font is drawn with
+# (source file, gfx font name, generated font name, characters)
+FONTS = [
+    ('Monofonto10pt.h', 'monofonto10pt7b', 'font_monofonto10', ASCII),  # location, date and time
+    ('Monofonto12pt.h', 'monofonto12pt7b', 'font_monofonto12', NUMBERS),  # pressure, wind, pm2.5
+    ('Monofonto18pt.h', 'monofonto18pt7b', 'font_monofonto18', NUMBERS),  # current temperature
+    ('MeteoCons8pt.h', 'meteocons_webfont8pt7b', 'font_meteocons8', '*'),  # degree sign
+    ('MeteoCons10pt.h', 'meteocons_webfont10pt7b', 'font_meteocons10', METEO_ICONS),
+    ('Cousine6pt.h', 'Cousine_Regular6pt7b', 'font_cousine6', ASCII),  # description, forecast, labels
+]
+
+# GFX fonts of the config and validating screens (display.h)
+# (source file, gfx font name, characters)
+GFX_FONTS = [
+    ('Monofonto10pt.h', 'monofonto10pt7b', 'Validating configuration...'),
+    ('Monofonto18pt.h', 'monofonto18pt7b', 'Welcome!'),
+    ('Cousine6pt.h', 'Cousine_Regular6pt7b', ASCII),  # ssid and password
+]
+
+
+class Glyph:
+    def __init__(self, offset, width, height, x_advance, x_offset, y_offset):
+        self.offset = offset
+        self.width = width
+        self.height = height
+        self.x_advance = x_advance
+        self.x_offset = x_offset
+        self.y_offset = y_offset
+
+
+def parse_gfx_font(path, name):
+    with open(path) as f:
+        source = f.read()
+
+    bitmap_src = re.search(name + r'Bitmaps\[\]\s*PROGMEM\s*=\s*\{(.*?)\};', source, re.S).group(1)
+    bitmap = [int(b, 16) for b in re.findall(r'0x[0-9A-Fa-f]{2}', bitmap_src)]
+
+    glyph_src = re.search(name + r'Glyphs\[\]\s*PROGMEM\s*=\s*\{(.*?)\};', source, re.S).group(1)
+    glyph_src = re.sub(r'//[^\n]*', '', glyph_src)
+    glyphs = [Glyph(*map(int, g)) for g in re.findall(
+        r'\{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+)\s*\}', glyph_src)]
+
+    font_src = re.search(r'GFXfont\s+' + name + r'\s*PROGMEM\s*=\s*\{(.*?)\};', source, re.S).group(1)
+    first, last, y_advance = [int(v, 0) for v in font_src.split(',')[2:5]]
+    return bitmap, glyphs, first, last, y_advance
+
+
+def glyph_pixels(bitmap, glyph):
+    # gfx glyphs are row-major, bits run on across rows
+    pixels = []
+    bit = 0
+    for y in range(glyph.height):
+        row = []
+        for x in range(glyph.width):
+            byte = bitmap[glyph.offset + bit // 8]
+            row.append((byte >> (7 - bit % 8)) & 1)
+            bit += 1
+        pixels.append(row)
+    return pixels
+
+
+def column_bytes(pixels, width, height):
+    out = []
+    for x in range(width):
+        for y0 in range(0, height, 8):
+            byte = 0
+            for y in range(y0, min(y0 + 8, height)):
+                byte |= pixels[y][x] << (7 - (y - y0))
+            out.append(byte)
+    return out
+
+
+def max_glyph_height():
+    with open(FRAMEBUFFER_H) as f:
+        return int(re.search(r'#define\s+MAX_GLYPH_HEIGHT\s+(\d+)', f.read()).group(1))
+
+
+def subset_range(chars):
+    return min(ord(c) for c in chars), max(ord(c) for c in chars)
+
+
+def convert(source_file, gfx_name, name, chars):
+    bitmap, glyphs, first, last, y_advance = parse_gfx_font(os.path.join(FONT_DIR, source_file), gfx_name)
+    sub_first, sub_last = subset_range(chars)
+    max_height = max_glyph_height()
+    out_bitmap = []
+    out_glyphs = []
+
+    for c in range(sub_first, sub_last + 1):
+        glyph = glyphs[c - first]
+        if chr(c) not in chars:
+            out_glyphs.append(Glyph(0, 0, 0, glyph.x_advance, 0, 0))
+            continue
+        if glyph.height > max_height:
+            sys.exit('%s: %r is %d rows tall, FrameBuffer draws glyphs up to MAX_GLYPH_HEIGHT %d rows' % (
+                source_file, chr(c), glyph.height, max_height))
+        pixels = glyph_pixels(bitmap, glyph)
+        out_glyphs.append(Glyph(len(out_bitmap), glyph.width, glyph.height,
+                                glyph.x_advance, glyph.x_offset, glyph.y_offset))
+        out_bitmap += column_bytes(pixels, glyph.width, glyph.height)
+
+    lines = ['// %s from %s, %d of %d glyphs' % (name, source_file, len(set(chars)), last - first + 1)]
+    lines.append('const uint8_t %s_bitmap[] PROGMEM = {' % name)
+    for i in range(0, len(out_bitmap), 12):
+        lines.append('  ' + ', '.join('0x%02X' % b for b in out_bitmap[i:i + 12]) + ',')
+    lines.append('};')
+    lines.append('')
+    lines.append('const RotatedGlyph %s_glyphs[] PROGMEM = {' % name)
+    for i, g in enumerate(out_glyphs):
+        c = sub_first + i
+        lines.append('  { %5d, %3d, %3d, %3d, %3d, %4d },  // 0x%02X %s' % (
+            g.offset, g.width, g.height, g.x_advance, g.x_offset, g.y_offset, c, repr(chr(c))))
+    lines.append('};')
+    lines.append('')
+    lines.append('const RotatedFont %s PROGMEM = { %s_bitmap, %s_glyphs, 0x%02X, 0x%02X, %d };' % (
+        name, name, name, sub_first, sub_last, y_advance))
+    lines.append('')
+    digit = glyphs[ord('0') - first]
+    inked = [glyphs[ord(c) - first] for c in chars]
+    inked = [g for g in inked if g.width > 0 and g.height > 0]
+    ascent = max([0] + [-g.y_offset for g in inked])
+    descent = max([0] + [g.y_offset + g.height for g in inked])
+    lines.append('// advance, cap height, ascent, descent, line height')
+    lines.append('constexpr FontMetrics %s_metrics = { %d, %d, %d, %d, %d };' % (
+        name, digit.x_advance, -digit.y_offset, ascent, descent, y_advance))
+    lines.append('')
+    lines.append('')
+    return '\n'.join(lines)
+
+
+def convert_gfx(source_file, name, chars):
+    bitmap, glyphs, first, last, y_advance = parse_gfx_font(os.path.join(FONT_DIR, source_file), name)
+    sub_first, sub_last = subset_range(chars)
+    out_bitmap = []
+    out_glyphs = []
+
+    for c in range(sub_first, sub_last + 1):
+        glyph = glyphs[c - first]
+        if chr(c) not in chars:
+            out_glyphs.append(Glyph(0, 0, 0, glyph.x_advance, 0, 0))
+            continue
+        size = (glyph.width * glyph.height + 7) // 8
+        out_glyphs.append(Glyph(len(out_bitmap), glyph.width, glyph.height,
+                                glyph.x_advance, glyph.x_offset, glyph.y_offset))
+        out_bitmap += bitmap[glyph.offset:glyph.offset + size]
+
+    lines = ['// %s from %s, %d of %d glyphs' % (name, source_file, len(set(chars)), last - first + 1)]
+    lines.append('const uint8_t %sBitmaps[] PROGMEM = {' % name)
+    for i in range(0, len(out_bitmap), 12):
+        lines.append('  ' + ', '.join('0x%02X' % b for b in out_bitmap[i:i + 12]) + ',')
+    lines.append('};')
+    lines.append('')
+    lines.append('const GFXglyph %sGlyphs[] PROGMEM = {' % name)
+    for i, g in enumerate(out_glyphs):
+        c = sub_first + i
+        lines.append('  { %5d, %3d, %3d, %3d, %3d, %4d },  // 0x%02X %s' % (
+            g.offset, g.width, g.height, g.x_advance, g.x_offset, g.y_offset, c, repr(chr(c))))
+    lines.append('};')
+    lines.append('')
+    lines.append('const GFXfont %s PROGMEM = { (uint8_t *) %sBitmaps, (GFXglyph *) %sGlyphs, 0x%02X, 0x%02X, %d };' % (
+        name, name, name, sub_first, sub_last, y_advance))
+    lines.append('')
+    lines.append('')
+    return '\n'.join(lines)
+
+
+def main():
+    if '--gfx' in sys.argv[1:]:
+        out = [
+            '// Generated by tools/fontgen.py --gfx, do not edit.',
+            '#ifndef _gfx_fonts_h',
+            '#define _gfx_fonts_h',
+            '',
+            '',
+        ]
+        for font in GFX_FONTS:
+            out.append(convert_gfx(*font))
+    else:
+        out = [
+            '// Generated by tools/fontgen.py, do not edit.',
+            '#ifndef _rotated_fonts_h',
+            '#define _rotated_fonts_h',
+            '',
+            '#include "framebuffer.h"',
+            '',
+            '',
+        ]
+        for font in FONTS:
+            out.append(convert(*font))
+    out.append('#endif')
+    sys.stdout.write('\n'.join(out) + '\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,244 @@
+// Reads gzip'ed onecall responses on a Linux host the way weather_handler
+// does on the device: ChunkedStream -> GzipStream -> JsonPathReader over a
+// stand-in socket handing out the body in small pieces. Every value has to
+// come out as from the plain json, damaged bodies have to fail.
+//
+// Build and run from the repository root:
+//   g++ -std=c++11 -O2 -I tools/host -I weather_tiny tools/gzip_host.cpp -lz -o gzip_host
+//   ./gzip_host [onecall json, default tools/host/fixtures/onecall.json]
+//
+// zlib compresses the bodies, they are inflated by the tinfl of the esp32 rom
+// built for the host (tools/host/rom/miniz.h).
+
+#include <zlib.h>
+#include <string>
+#include <vector>
+#include "Arduino.h"
+#include "host_stream.h"
+
+#include "chunked_stream.h"
+#include "gzip_stream.h"
+#include "json_extract.h"
+
+
+static int failed_cnt = 0;
+
+
+void check(bool ok, const std::string& name) {
+    printf("%-52s %s\n", name.c_str(), ok ? "ok" : "FAILED");
+    failed_cnt += !ok;
+}
+
+
+std::string read_file(const char* path) {
+    FILE* f = fopen(path, "rb");
+    if (!f) {
+        fprintf(stderr, "Cannot read %s\n", path);
+        exit(1);
+    }
+    std::string content;
+    char buffer[4096];
+    for (size_t n; (n = fread(buffer, 1, sizeof(buffer), f)) > 0; ) {
+        content.append(buffer, n);
+    }
+    fclose(f);
+    return content;
+}
+
+
+// gzip member as servers send it, with_name adds the optional file name field,
+// level 0 gives stored blocks, Z_FIXED fixed huffman codes
+std::string gzip(const std::string& data, bool with_name, int level = Z_BEST_COMPRESSION, int strategy = Z_DEFAULT_STRATEGY) {
+    z_stream z = {};
+    deflateInit2(&z, level, Z_DEFLATED, MAX_WBITS + 16, 9, strategy);
+    gz_header header = {};
+    char name[] = "onecall.json";
+    if (with_name) {
+        header.name = (Bytef*) name;
+        deflateSetHeader(&z, &header);
+    }
+    std::string out(deflateBound(&z, data.size()) + 64, '\0');
+    z.next_in = (Bytef*) data.data();
+    z.avail_in = data.size();
+    z.next_out = (Bytef*) &out[0];
+    z.avail_out = out.size();
+    deflate(&z, Z_FINISH);
+    out.resize(z.total_out);
+    deflateEnd(&z);
+    return out;
+}
+
+
+// chunked transfer encoding with chunks of up to max_chunk bytes
+std::string chunk(const std::string& body, size_t max_chunk) {
+    std::string out;
+    unsigned int seed = 7;
+    for (size_t pos = 0; pos < body.size(); ) {
+        seed = seed * 1103515245 + 12345;
+        size_t size = min(body.size() - pos, 1 + (seed >> 8) % max_chunk);
+        char line[32];
+        sprintf(line, pos == 0 ? "%zx;name=value\r\n" : "%zX\r\n", size);  // extension, upper case hex
+        out += line;
+        out += body.substr(pos, size);
+        out += "\r\n";
+        pos += size;
+    }
+    return out + "0\r\n\r\n";
+}
+
+
+// Several windows of bytes repeating earlier runs from up to the full 32 KB
+// back, the copies start anywhere in the window and wrap over its end
+std::string window_data(size_t size) {
+    std::string data;
+    unsigned int seed = 11;
+    while (data.size() < size) {
+        seed = seed * 1103515245 + 12345;
+        size_t run = 3 + (seed >> 8) % 250;
+        if (data.size() > TINFL_LZ_DICT_SIZE && (seed >> 20) % 3 > 0) {
+            size_t distance = TINFL_LZ_DICT_SIZE - (seed >> 4) % 64;
+            if ((seed >> 16) % 2) {
+                distance = 1 + (seed >> 3) % TINFL_LZ_DICT_SIZE;
+            }
+            for (size_t i = 0; i < run; i++) {
+                data += data[data.size() - distance];
+            }
+        } else {
+            for (size_t i = 0; i < run; i++) {
+                seed = seed * 1103515245 + 12345;
+                data += (char) ('a' + (seed >> 16) % 16);
+            }
+        }
+    }
+    return data;
+}
+
+
+// every byte GzipStream hands out, read in pieces of varying size
+std::string inflate_body(const std::string& body, size_t max_piece, bool& failed) {
+    HostStream socket(body, max_piece);
+    GzipStream gzip_stream(socket);
+    std::string out;
+    char buffer[4096];
+    unsigned int seed = 3;
+    for (size_t n = 1; n > 0; ) {
+        seed = seed * 1103515245 + 12345;
+        n = gzip_stream.readBytes(buffer, 1 + (seed >> 8) % sizeof(buffer));
+        out.append(buffer, n);
+    }
+    failed = gzip_stream.failed();
+    return out;
+}
+
+
+// the reader stops at the closing brace, whitespace after it may stay compressed
+size_t document_size(const std::string& json) {
+    return json.find_last_not_of(" \r\n\t") + 1;
+}
+
+
+void collect_value(const char* path, const char* value, void* context) {
+    std::vector<std::string>& values = *(std::vector<std::string>*) context;
+    values.push_back(std::string(path) + "=" + value);
+}
+
+
+struct Result {
+    bool read;
+    bool failed;
+    size_t inflated_bytes;
+    std::vector<std::string> values;
+} ;
+
+
+// body: bytes on the socket, the headers set chunked and gzip_encoded as in http_request_data
+Result read_body(const std::string& body, bool chunked, bool gzip_encoded, size_t max_piece) {
+    HostStream socket(body, max_piece);
+    ChunkedStream chunked_stream(socket);
+    Stream& source = chunked ? (Stream&) chunked_stream : (Stream&) socket;
+    GzipStream gzip_stream(source);
+    JsonPathReader reader(gzip_encoded ? (Stream&) gzip_stream : source);
+
+    Result result;
+    result.read = reader.read(collect_value, &result.values);
+    result.failed = !result.read || gzip_stream.failed() || chunked_stream.failed();
+    result.inflated_bytes = gzip_stream.inflated_bytes();
+    return result;
+}
+
+
+int main(int argc, char** argv) {
+    const char* fixture = argc > 1 ? argv[1] : "tools/host/fixtures/onecall.json";
+    const std::string json = read_file(fixture);
+
+    // more than the 32 KB window, back references reach over the wrap
+    std::string large = "[" + json;
+    for (int i = 0; i < 5; i++) {
+        large += "," + json;
+    }
+    large += "]";
+
+    Result plain = read_body(json, false, false, 0);
+    Result large_plain = read_body(large, false, false, 0);
+    check(plain.read && plain.values.size() > 500, "plain json read");
+
+    for (size_t piece : { 0, 1, 7, 300, 1460 }) {
+        std::string suffix = " (pieces up to " + std::to_string(piece) + " bytes)";
+        Result r = read_body(gzip(json, false), false, true, piece);
+        check(!r.failed && r.values == plain.values && r.inflated_bytes >= document_size(json), "gzip" + suffix);
+
+        r = read_body(gzip(json, true), false, true, piece);
+        check(!r.failed && r.values == plain.values, "gzip with file name" + suffix);
+
+        r = read_body(chunk(json, 500), true, false, piece);
+        check(!r.failed && r.values == plain.values, "chunked" + suffix);
+
+        r = read_body(chunk(gzip(json, false), 500), true, true, piece);
+        check(!r.failed && r.values == plain.values, "chunked gzip" + suffix);
+
+        r = read_body(chunk(gzip(large, false), 4096), true, true, piece);
+        check(!r.failed && r.values == large_plain.values && r.inflated_bytes >= document_size(large),
+            "chunked gzip over the window" + suffix);
+    }
+
+    const std::string data = window_data(5 * TINFL_LZ_DICT_SIZE + 123);
+    struct { const char* name; int level; int strategy; } modes[] = {
+        { "dynamic huffman", Z_BEST_COMPRESSION, Z_DEFAULT_STRATEGY },
+        { "fixed huffman", Z_BEST_COMPRESSION, Z_FIXED },
+        { "stored", 0, Z_DEFAULT_STRATEGY },
+    };
+    for (auto& mode : modes) {
+        for (size_t piece : { 0, 1, 1460 }) {
+            bool failed;
+            std::string out = inflate_body(gzip(data, false, mode.level, mode.strategy), piece, failed);
+            check(!failed && out == data, std::string("window wraps, ") + mode.name + " (pieces up to " + std::to_string(piece) + ")");
+        }
+    }
+
+    std::string compressed = gzip(json, false);
+    Result r = read_body(compressed.substr(0, compressed.size() * 2 / 3), false, true, 300);
+    check(r.failed, "truncated gzip fails");
+
+    std::string damaged = compressed;
+    for (size_t i = 40; i < 60; i++) {
+        damaged[i] = ~damaged[i];
+    }
+    r = read_body(damaged, false, true, 300);
+    check(r.failed || r.values != plain.values, "damaged gzip does not pass as the response");
+
+    r = read_body(json, false, true, 300);
+    check(r.failed, "plain body announced as gzip fails");
+
+    std::string chunked = chunk(gzip(json, false), 500);
+    r = read_body(chunked.substr(0, chunked.size() / 2), true, true, 300);
+    check(r.failed, "truncated chunked body fails");
+
+    r = read_body("zz\r\n" + chunked, true, true, 300);
+    check(r.failed, "bad chunk size fails");
+
+    if (failed_cnt > 0) {
+        printf("%d checks failed\n", failed_cnt);
+        return 1;
+    }
+    return 0;
+}
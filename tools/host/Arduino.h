@@ -0,0 +1,119 @@
+// Just enough of the Arduino core to compile the sketch's display, stream,
+// json and dns code on a Linux host, see tools/render_host.cpp,
+// tools/gzip_host.cpp, tools/json_host.cpp and tools/dns_cache_host.cpp.
+#ifndef _host_arduino_h
+#define _host_arduino_h
+
+#include <ctype.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <chrono>
+#include <string>
+#include <type_traits>
+
+#define PROGMEM
+#define RTC_DATA_ATTR
+#define pgm_read_byte(addr) (*(const uint8_t*) (addr))
+
+// single threaded, critical sections need no lock
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define taskENTER_CRITICAL(mux) ((void) (mux))
+#define taskEXIT_CRITICAL(mux) ((void) (mux))
+
+
+class String : public std::string {
+public:
+    String(const char* text = "") : std::string(text) {}
+    String(const std::string& text) : std::string(text) {}
+    String(char c) : std::string(1, c) {}
+    String(int value) : std::string(std::to_string(value)) {}
+    String(unsigned int value) : std::string(std::to_string(value)) {}
+    String(long value) : std::string(std::to_string(value)) {}
+    String(unsigned long value) : std::string(std::to_string(value)) {}
+    String(double value, unsigned int decimals = 2) : std::string(_fixed(value, decimals)) {}
+
+    bool equalsIgnoreCase(const String& other) const { return strcasecmp(c_str(), other.c_str()) == 0; }
+    float toFloat() const { return strtof(c_str(), NULL); }
+    long toInt() const { return strtol(c_str(), NULL, 10); }
+    void toUpperCase() { for (char& c : *this) c = toupper(c); }
+    void trim() { erase(find_last_not_of(" \t\r\n") + 1); erase(0, find_first_not_of(" \t\r\n")); }
+
+    bool equals(const String& other) const { return *this == other; }
+    String substring(unsigned int from) const { return from < size() ? substr(from) : ""; }
+    String substring(unsigned int from, unsigned int to) const { return from < size() ? substr(from, to - from) : ""; }
+    int indexOf(char c) const { size_t i = find(c); return i == npos ? -1 : (int) i; }
+    String& operator+=(const String& other) { append(other); return *this; }
+
+    private:
+
+    static std::string _fixed(double value, unsigned int decimals) {
+        char text[32];
+        snprintf(text, sizeof(text), "%.*f", decimals, value);
+        return text;
+    }
+} ;
+
+inline String operator+(const String& a, const String& b) { return String(std::string(a) + std::string(b)); }
+inline String operator+(const String& a, const char* b) { return String(std::string(a) + b); }
+inline String operator+(const char* a, const String& b) { return String(a + std::string(b)); }
+
+
+struct HostSerial {
+    void begin(unsigned long) {}
+    void print(const String& text) { fputs(text.c_str(), stdout); }
+    void println(const String& text = "") { puts(text.c_str()); }
+    template<typename... Args>
+    void printf(const char* format, Args... args) { ::printf(format, args...); }
+} ;
+
+HostSerial Serial;
+
+
+template<typename A, typename B>
+inline typename std::common_type<A, B>::type min(A a, B b) {
+    return a < b ? a : b;
+}
+
+
+class Stream {
+public:
+    virtual ~Stream() {}
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    virtual size_t write(uint8_t) = 0;
+    virtual void flush() {}
+
+    virtual size_t readBytes(char* buffer, size_t length) {
+        size_t count = 0;
+        for (int c; count < length && (c = read()) >= 0; ) {
+            buffer[count++] = c;
+        }
+        return count;
+    }
+
+    size_t readBytes(uint8_t* buffer, size_t length) {
+        return readBytes((char*) buffer, length);
+    }
+} ;
+
+
+inline unsigned long micros() {
+    using namespace std::chrono;
+    static const steady_clock::time_point start = steady_clock::now();
+    return duration_cast<microseconds>(steady_clock::now() - start).count();
+}
+
+inline unsigned long millis() {
+    return micros() / 1000;
+}
+
+inline void delay(unsigned long) {}
+
+
+#endif
@@ -0,0 +1,273 @@
+// In-memory stand-in for the GxEPD display with the Adafruit GFX drawing
+// used by weather_tiny/display.h and tools/host/gfx_screen.h, see
+// tools/render_host.cpp. Pixels go through the rotation 3 transform into a
+// panel layout buffer as in the GxGDE0213B72B driver, every pixel takes the
+// same steps as on the device.
+#ifndef _host_gxepd_h
+#define _host_gxepd_h
+
+#include <utility>
+#include "Arduino.h"
+
+#define GxEPD_BLACK 0x0000
+#define GxEPD_WHITE 0xFFFF
+
+enum { bm_normal = 0, bm_partial_update = 1 << 6 };
+
+
+typedef struct {
+    uint16_t bitmapOffset;
+    uint8_t width, height;
+    uint8_t xAdvance;
+    int8_t xOffset, yOffset;
+} GFXglyph;
+
+typedef struct {
+    uint8_t* bitmap;
+    GFXglyph* glyph;
+    uint8_t first, last;
+    uint8_t yAdvance;
+} GFXfont;
+
+
+template<int WIDTH, int HEIGHT>
+class HostDisplay {
+public:
+    void init(unsigned long) {}
+    void setRotation(int) {}
+    void setTextWrap(bool) {}
+    void setTextColor(uint16_t color) { _color = color; }
+    void setFont(const GFXfont* font) { _font = font; }
+    void setCursor(int16_t x, int16_t y) { _cursor_x = x; _cursor_y = y; }
+    int16_t getCursorX() const { return _cursor_x; }
+    int16_t getCursorY() const { return _cursor_y; }
+    void update() { update_cnt++; }
+    void powerDown() {}
+
+    void fillScreen(uint16_t color) {
+        memset(_buffer, color == GxEPD_BLACK ? 0x00 : 0xFF, sizeof(_buffer));
+    }
+
+    // GxGDE0213B72B drawPixel with setRotation(3), white is a set bit
+    void drawPixel(int16_t x, int16_t y, uint16_t color) {
+        if (x < 0 || x >= WIDTH || y < 0 || y >= HEIGHT) {
+            return;
+        }
+        int16_t t = x;
+        x = y;
+        y = WIDTH - t - 1;
+        uint16_t i = x / 8 + y * NATIVE_WIDTH / 8;
+        if (color) {
+            _buffer[i] = _buffer[i] | (1 << (7 - x % 8));
+        } else {
+            _buffer[i] = _buffer[i] & (0xFF ^ (1 << (7 - x % 8)));
+        }
+    }
+
+    // black is true, in screen coordinates
+    bool pixel(int x, int y) const {
+        return !(_buffer[y / 8 + (WIDTH - x - 1) * NATIVE_WIDTH / 8] & (1 << (7 - y % 8)));
+    }
+
+    // Adafruit GFX shapes, every one drawn pixel by pixel through drawPixel
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+        for (int16_t i = 0; i < h; i++) {
+            drawPixel(x, y + i, color);
+        }
+    }
+
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+        for (int16_t i = 0; i < w; i++) {
+            drawPixel(x + i, y, color);
+        }
+    }
+
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        drawFastHLine(x, y, w, color);
+        drawFastHLine(x, y + h - 1, w, color);
+        drawFastVLine(x, y, h, color);
+        drawFastVLine(x + w - 1, y, h, color);
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        for (int16_t i = x; i < x + w; i++) {
+            drawFastVLine(i, y, h, color);
+        }
+    }
+
+    void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+        int16_t max_radius = ((w < h) ? w : h) / 2;
+        if (r > max_radius) {
+            r = max_radius;
+        }
+        fillRect(x + r, y, w - 2 * r, h, color);
+        _fill_circle_helper(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, color);
+        _fill_circle_helper(x + r, y + r, r, 2, h - 2 * r - 1, color);
+    }
+
+    void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+        int16_t a, b, y, last;
+
+        // sort by y, y0 <= y1 <= y2
+        if (y0 > y1) { std::swap(y0, y1); std::swap(x0, x1); }
+        if (y1 > y2) { std::swap(y2, y1); std::swap(x2, x1); }
+        if (y0 > y1) { std::swap(y0, y1); std::swap(x0, x1); }
+
+        if (y0 == y2) {  // all on one line
+            a = b = x0;
+            if (x1 < a) a = x1;
+            else if (x1 > b) b = x1;
+            if (x2 < a) a = x2;
+            else if (x2 > b) b = x2;
+            drawFastHLine(a, y0, b - a + 1, color);
+            return;
+        }
+
+        int16_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0,
+            dx12 = x2 - x1, dy12 = y2 - y1;
+        int32_t sa = 0, sb = 0;
+
+        // upper part, the y1 line is included when y1 == y2 (flat bottom)
+        last = y1 == y2 ? y1 : y1 - 1;
+        for (y = y0; y <= last; y++) {
+            a = x0 + sa / dy01;
+            b = x0 + sb / dy02;
+            sa += dx01;
+            sb += dx02;
+            if (a > b) std::swap(a, b);
+            drawFastHLine(a, y, b - a + 1, color);
+        }
+
+        // lower part
+        sa = (int32_t) dx12 * (y - y1);
+        sb = (int32_t) dx02 * (y - y0);
+        for (; y <= y2; y++) {
+            a = x1 + sa / dy12;
+            b = x0 + sb / dy02;
+            sa += dx12;
+            sb += dx02;
+            if (a > b) std::swap(a, b);
+            drawFastHLine(a, y, b - a + 1, color);
+        }
+    }
+
+    // the frame arrives in the panel layout, it is only counted
+    void drawBitmap(const uint8_t*, uint32_t, int16_t mode) {
+        mode == bm_partial_update ? partial_cnt++ : full_cnt++;
+    }
+
+    // Adafruit GFX getTextBounds for a custom font, no wrapping
+    void getTextBounds(const String& text, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+        int min_x = 0x7FFF, min_y = 0x7FFF, max_x = -1, max_y = -1;
+
+        for (const char* c = text.c_str(); *c; c++) {
+            if (*c == '\n') {
+                x = 0;
+                y += _font->yAdvance;
+                continue;
+            }
+            if ((uint8_t) *c < _font->first || (uint8_t) *c > _font->last) {
+                continue;
+            }
+            const GFXglyph& glyph = _font->glyph[(uint8_t) *c - _font->first];
+            int gx1 = x + glyph.xOffset, gy1 = y + glyph.yOffset;
+            int gx2 = gx1 + glyph.width - 1, gy2 = gy1 + glyph.height - 1;
+            if (gx1 < min_x) min_x = gx1;
+            if (gy1 < min_y) min_y = gy1;
+            if (gx2 > max_x) max_x = gx2;
+            if (gy2 > max_y) max_y = gy2;
+            x += glyph.xAdvance;
+        }
+        *x1 = *y1 = 0;
+        *w = *h = 0;
+        if (max_x >= min_x) {
+            *x1 = min_x;
+            *w = max_x - min_x + 1;
+        }
+        if (max_y >= min_y) {
+            *y1 = min_y;
+            *h = max_y - min_y + 1;
+        }
+    }
+
+    void print(const String& text) {
+        for (const char* c = text.c_str(); *c; c++) {
+            _write((uint8_t) *c);
+        }
+    }
+
+    int update_cnt = 0;
+    int full_cnt = 0;
+    int partial_cnt = 0;
+
+
+    private:
+
+    static const int NATIVE_WIDTH = (HEIGHT + 7) / 8 * 8;  // panel row, whole bytes
+
+    void _fill_circle_helper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta, uint16_t color) {
+        int16_t f = 1 - r;
+        int16_t ddF_x = 1;
+        int16_t ddF_y = -2 * r;
+        int16_t x = 0;
+        int16_t y = r;
+        int16_t px = x;
+        int16_t py = y;
+
+        delta++;  // avoid some +1's in the loop
+        while (x < y) {
+            if (f >= 0) {
+                y--;
+                ddF_y += 2;
+                f += ddF_y;
+            }
+            x++;
+            ddF_x += 2;
+            f += ddF_x;
+            // these checks avoid double-drawing certain lines
+            if (x < (y + 1)) {
+                if (corners & 1) drawFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
+                if (corners & 2) drawFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
+            }
+            if (y != py) {
+                if (corners & 1) drawFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
+                if (corners & 2) drawFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
+                py = y;
+            }
+            px = x;
+        }
+    }
+
+    // Adafruit GFX write and drawChar for a custom font
+    void _write(uint8_t c) {
+        if (c == '\n') {
+            _cursor_x = 0;
+            _cursor_y += _font->yAdvance;
+            return;
+        }
+        if (c == '\r' || c < _font->first || c > _font->last) {
+            return;
+        }
+        const GFXglyph& glyph = _font->glyph[c - _font->first];
+        const uint8_t* bitmap = _font->bitmap + glyph.bitmapOffset;
+        int bit = 0;
+
+        for (int y = 0; y < glyph.height; y++) {
+            for (int x = 0; x < glyph.width; x++, bit++) {
+                if (bitmap[bit / 8] & (0x80 >> (bit % 8))) {
+                    drawPixel(_cursor_x + glyph.xOffset + x, _cursor_y + glyph.yOffset + y, _color);
+                }
+            }
+        }
+        _cursor_x += glyph.xAdvance;
+    }
+
+    const GFXfont* _font = nullptr;
+    uint16_t _color = GxEPD_BLACK;
+    int16_t _cursor_x = 0;
+    int16_t _cursor_y = 0;
+    uint8_t _buffer[NATIVE_WIDTH / 8 * WIDTH];
+} ;
+
+
+#endif
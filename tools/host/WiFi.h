@@ -0,0 +1,69 @@
+// Stand-in for the WiFi library, only the client type the response
+// handlers read from, see tools/json_host.cpp, and the address and event
+// group types weather_tiny/dns_resolve.h uses, see tools/dns_cache_host.cpp.
+#ifndef _host_wifi_h
+#define _host_wifi_h
+
+#include "Arduino.h"
+
+
+class WiFiClient : public Stream {
+} ;
+
+
+class IPAddress {
+public:
+    IPAddress(uint32_t address = 0) : _address(address) {}  // network byte order
+
+    String toString() const {
+        char text[16];
+        snprintf(text, sizeof(text), "%u.%u.%u.%u",
+            _address & 0xff, (_address >> 8) & 0xff, (_address >> 16) & 0xff, _address >> 24);
+        return text;
+    }
+
+    private:
+
+    uint32_t _address;
+} ;
+
+
+#define BIT0 0x00000001
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdMS_TO_TICKS(ms) (ms)
+
+typedef uint32_t EventBits_t;
+typedef uint32_t TickType_t;
+typedef struct HostEventGroup {
+    EventBits_t bits;
+} * EventGroupHandle_t;
+
+// runs in place of the time a task blocks in xEventGroupWaitBits
+void (*host_event_wait_hook)() = NULL;
+
+
+inline EventGroupHandle_t xEventGroupCreate() {
+    return new HostEventGroup { 0 };
+}
+
+inline EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits) {
+    return group->bits |= bits;
+}
+
+inline EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits) {
+    EventBits_t before = group->bits;
+    group->bits &= ~bits;
+    return before;
+}
+
+// never blocks, returns what is set once the hook ran
+inline EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t, int, int, TickType_t) {
+    if (host_event_wait_hook != NULL) {
+        host_event_wait_hook();
+    }
+    return group->bits;
+}
+
+
+#endif
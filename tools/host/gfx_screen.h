@@ -0,0 +1,188 @@
+// The weather screen as weather_tiny/display.h drew it through Adafruit GFX
+// before render.h replaced it, kept as the baseline render_host compares the
+// frame buffer renderer with. Copied from display.h with two changes: the
+// unit labels the View no longer holds are literals, and WindArrow::rotate
+// no longer logs (Serial would dominate the timing on the host).
+#ifndef _host_gfx_screen_h
+#define _host_gfx_screen_h
+
+#include "GxEPD.h"
+#include "view.h"
+
+
+// the full bundled fonts, gfx_fonts.h keeps only the glyphs of the config screens
+namespace full_fonts {
+#include "../../libraries/Adafruit_GFX_Library/Fonts/Cousine6pt.h"
+#include "../../libraries/Adafruit_GFX_Library/Fonts/MeteoCons10pt.h"
+#include "../../libraries/Adafruit_GFX_Library/Fonts/MeteoCons8pt.h"
+#include "../../libraries/Adafruit_GFX_Library/Fonts/Monofonto10pt.h"
+#include "../../libraries/Adafruit_GFX_Library/Fonts/Monofonto12pt.h"
+#include "../../libraries/Adafruit_GFX_Library/Fonts/Monofonto18pt.h"
+}
+
+
+struct WindArrow {
+    int x = 0, y = 0;
+    int scale = 1;
+    int offset = -3;
+    float deg2rad = 0.01745;
+
+    // 2 triangle coords. Center is (3, 3)
+    float x0 = 1 +offset, y0 = 0 +offset;  // top left
+    float x1 = 3 +offset, y1 = 2 +offset;  // bottom
+    float x2 = 3 +offset, y2 = 6 +offset;  // top
+    float x3 = 5 +offset, y3 = 0 +offset;  // top right
+
+    void rotate(int alpha) {
+        float rad = alpha * deg2rad;
+        _rotate_point(rad, &x0, &y0);
+        _rotate_point(rad, &x1, &y1);
+        _rotate_point(rad, &x2, &y2);
+        _rotate_point(rad, &x3, &y3);
+    }
+    
+    void draw(int x, int y, GxEPD_Class& display) {
+        this->x = x;
+        this->y = y;
+        display.fillTriangle(x+x0*scale, y+y0*scale, x+x1*scale, y+y1*scale, x+x2*scale, y+y2*scale, GxEPD_BLACK);
+        display.fillTriangle(x+x1*scale, y+y1*scale, x+x2*scale, y+y2*scale, x+x3*scale, y+y3*scale, GxEPD_BLACK);
+    }
+
+
+    private:
+    
+    void _rotate_point(float rad, float *x, float *y) {
+        float xc = *x - this->x;
+        float yc = *y - this->y;
+        
+        // p'x = cos(theta) * (px-ox) - sin(theta) * (py-oy) + ox
+        // p'y = sin(theta) * (px-ox) + cos(theta) * (py-oy) + oy
+        *x = cos(rad) * xc - sin(rad) * yc + this->x;
+        *y = sin(rad) * xc + cos(rad) * yc + this->y;
+    }
+} ;
+
+
+int display_battery_icon(int x, int y, GxEPD_Class& display, int percent) {
+    const int icon_width = 24;
+    const int icon_height = 12;
+    const int bar_width = 6;
+    const int bar_height = 8;
+    const int bar_margin = 2;
+    const int plus_rectangle_width = 4;
+
+    // icon rectangle
+    display.drawRect(x, y, icon_width, icon_height, GxEPD_BLACK);
+
+    // the small battery plus-side rectangle
+    display.fillRoundRect(x+icon_width-1, y+3, plus_rectangle_width, icon_height-2*3, 2, GxEPD_BLACK);
+
+    int level = battery_icon_level(percent);
+
+    // draw charging icon
+    if (level == BATTERY_CHARGING) {
+        const int margin = 2;
+        const int half_w = icon_width / 2;
+        const int half_h = icon_height / 2;
+
+        display.fillTriangle(x-margin+half_w, y+half_h, x-margin+half_w, y+half_h/2, x+half_w+half_w/2, y+half_h, GxEPD_BLACK);
+        display.fillTriangle(x+margin+half_w, y+half_h, x+margin+half_w, y+half_h+half_h/2, x+half_w-half_w/2, y+half_h, GxEPD_BLACK);
+        return icon_width + plus_rectangle_width;
+    }
+
+    // 3-level percent bar
+    for (int bar = 0; bar < level; bar++) {
+        display.fillRect(x+bar_margin+bar*(bar_width+1), y+bar_margin, bar_width, bar_height, GxEPD_BLACK);
+    }
+    return icon_width + plus_rectangle_width;
+}
+
+
+void display_header(View& view) {
+    display.setFont(&full_fonts::monofonto10pt7b);
+    print_text(0, -3, view.location);
+    print_text(SCREEN_WIDTH - get_text_width(view.datetime)-3, -12, view.datetime);
+    int batt_x = SCREEN_WIDTH - get_text_width(view.datetime) - 33;
+    display_battery_icon(batt_x, 3, display, view.battery_percent);
+}
+
+
+void display_weather(View& view) {
+    display.setFont(&full_fonts::meteocons_webfont10pt7b);
+    print_text(2, 21, view.weather_icon);
+    
+    display.setFont(&full_fonts::Cousine_Regular6pt7b);
+    print_text(30, 24, view.weather_desc);
+
+    display.setFont(&full_fonts::monofonto18pt7b);
+    print_text(30, 45, view.temp_curr);
+
+    display.setFont(&full_fonts::meteocons_webfont8pt7b);
+    print_text(78, 48, "*");  // celsius
+    
+    display.setFont(&full_fonts::Cousine_Regular6pt7b);
+    print_text(0, 45, view.temp_high);
+    print_text(0, 55, view.temp_low);
+    print_text(0, 65, view.temp_feel);
+
+    // pressure
+    display.setFont(&full_fonts::monofonto12pt7b);
+    print_text(100, 45, view.pressure);
+    
+    display.setFont(&full_fonts::Cousine_Regular6pt7b);
+    print_text(125, 65, "hPa");
+
+    // wind
+    display.setFont(&full_fonts::monofonto12pt7b);    
+    print_text(180, 45, view.wind);
+    WindArrow wind_arrow;
+    wind_arrow.rotate(view.wind_deg);
+    wind_arrow.scale = 4;
+    wind_arrow.draw(172, 55, display);
+
+    display.setFont(&full_fonts::Cousine_Regular6pt7b);
+    print_text(183, 65, "Bft");
+    
+    // hourly rain forecast
+    display.setFont(&full_fonts::Cousine_Regular6pt7b);
+    print_text(0, 83, "hour");
+    print_text(0, 98, "temp");
+    print_text(0, 112, "mm/%");
+
+    print_text(50-7, 85, view.percip_time[0]);
+    print_text(90-5, 85, view.percip_time[1]);
+    print_text(130-3, 85, view.percip_time[2]);
+    print_text(170-1, 85, view.percip_time[3]);
+    print_text(210+1, 85, view.percip_time[4]);
+
+    print_text(50-7, 102, view.percip[0]);
+    print_text(90-5, 102, view.percip[1]);
+    print_text(130-3, 102, view.percip[2]);
+    print_text(170-1, 102, view.percip[3]);
+    print_text(210+1, 102, view.percip[4]);
+
+    print_text(50-7, 112, view.percic_pop[0]);
+    print_text(90-5, 112, view.percic_pop[1]);
+    print_text(130-3, 112, view.percic_pop[2]);
+    print_text(170-1, 112, view.percic_pop[3]);
+    print_text(210+1, 112, view.percic_pop[4]);
+
+    display.setFont(&full_fonts::meteocons_webfont10pt7b);
+    print_text(61, 80, view.percip_icon[0]);
+    print_text(103, 80, view.percip_icon[1]);
+    print_text(145, 80, view.percip_icon[2]);
+    print_text(187, 80, view.percip_icon[3]);
+    print_text(229, 80, view.percip_icon[4]);
+}
+
+
+void display_air_quality(View& view) {
+    display.setFont(&full_fonts::monofonto12pt7b);
+    print_text(215, 45, view.aq_pm25);
+
+    display.setFont(&full_fonts::Cousine_Regular6pt7b);
+    print_text(215, 65, "PM2.5");
+}
+
+
+#endif
@@ -0,0 +1,71 @@
+// Stand-in for the WiFiClient a response is read from: hands out a body
+// kept in memory in pieces of random size, as bytes arriving over the
+// network. available() reports only what has "arrived" so far, readBytes()
+// of a single byte always gets it while the body lasts (waiting on the
+// socket on the device).
+#ifndef _host_stream_h
+#define _host_stream_h
+
+#include <string>
+#include "Arduino.h"
+
+
+class HostStream : public Stream {
+public:
+    // max_piece 0 hands out everything at once
+    explicit HostStream(const std::string& body, size_t max_piece = 0, unsigned int seed = 1)
+        : _body(body), _max_piece(max_piece), _seed(seed) { }
+
+    int available() override {
+        if (_arrived == _pos) {
+            _arrived = min(_body.size(), _pos + _piece());
+        }
+        return _arrived - _pos;
+    }
+
+    int read() override {
+        return _pos < _body.size() ? (uint8_t) _body[_pos++] : -1;
+    }
+
+    int peek() override {
+        return _pos < _body.size() ? (uint8_t) _body[_pos] : -1;
+    }
+
+    size_t readBytes(char* buffer, size_t length) override {
+        size_t count = min(length, _body.size() - _pos);
+        if (count > 1) {
+            count = min(count, _piece());
+        }
+        memcpy(buffer, _body.data() + _pos, count);
+        _pos += count;
+        return count;
+    }
+
+    size_t write(uint8_t) override {
+        return 0;
+    }
+
+    size_t position() const {
+        return _pos;
+    }
+
+
+    private:
+
+    size_t _piece() {
+        if (_max_piece == 0) {
+            return _body.size();
+        }
+        _seed = _seed * 1103515245 + 12345;
+        return 1 + (_seed >> 8) % _max_piece;
+    }
+
+    std::string _body;
+    size_t _max_piece;
+    unsigned int _seed;
+    size_t _pos = 0;
+    size_t _arrived = 0;
+} ;
+
+
+#endif
@@ -0,0 +1,73 @@
+// Stand-in for the lwip resolver used by weather_tiny/dns_resolve.h, see
+// tools/dns_cache_host.cpp. Queries are queued and answered when the caller
+// waits for them (host_event_wait_hook), slow hosts one wait later, after
+// the caller gave up on them.
+#ifndef _host_lwip_dns_h
+#define _host_lwip_dns_h
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include "WiFi.h"
+
+typedef int8_t err_t;
+#define ERR_OK 0
+#define ERR_INPROGRESS -5
+
+struct ip4_addr_t {
+    uint32_t addr;
+} ;
+
+struct ip_addr_t {
+    union {
+        ip4_addr_t ip4;
+    } u_addr;
+} ;
+
+typedef void (*dns_found_callback)(const char* name, const ip_addr_t* ipaddr, void* callback_arg);
+
+
+struct HostDnsQuery {
+    std::string name;
+    dns_found_callback found;
+    void* callback_arg;
+    int waits_left;
+} ;
+
+std::map<std::string, uint32_t> host_dns_answers;  // hosts missing here are not found
+std::set<std::string> host_dns_slow;
+std::vector<std::string> host_dns_queried;
+std::vector<HostDnsQuery> host_dns_queries;
+bool host_in_tcpip_thread = false;  // set by the tcpip_api_call stand-in
+int host_dns_unlocked_cnt = 0;  // queries sent from outside the tcpip thread
+
+
+err_t dns_gethostbyname(const char* name, ip_addr_t* addr, dns_found_callback found, void* callback_arg) {
+    (void) addr;
+    host_dns_unlocked_cnt += !host_in_tcpip_thread;
+    host_dns_queried.push_back(name);
+    host_dns_queries.push_back({ name, found, callback_arg, host_dns_slow.count(name) ? 1 : 0 });
+    return ERR_INPROGRESS;
+}
+
+
+// answers the queries due, in the order they were sent
+void host_dns_answer_due() {
+    std::vector<HostDnsQuery> queries;
+    queries.swap(host_dns_queries);
+
+    for (HostDnsQuery& query : queries) {
+        if (query.waits_left-- > 0) {
+            host_dns_queries.push_back(query);
+            continue;
+        }
+        std::map<std::string, uint32_t>::iterator it = host_dns_answers.find(query.name);
+        ip_addr_t addr;
+        addr.u_addr.ip4.addr = it == host_dns_answers.end() ? 0 : it->second;
+        query.found(query.name.c_str(), it == host_dns_answers.end() ? NULL : &addr, query.callback_arg);
+    }
+}
+
+
+#endif
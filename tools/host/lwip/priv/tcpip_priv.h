@@ -0,0 +1,23 @@
+// Stand-in for the lwip tcpip thread api used by weather_tiny/dns_resolve.h,
+// see tools/dns_cache_host.cpp. The call runs right away in the caller,
+// marked as running in the tcpip thread.
+#ifndef _host_lwip_tcpip_priv_h
+#define _host_lwip_tcpip_priv_h
+
+#include "lwip/dns.h"
+
+struct tcpip_api_call_data {
+    err_t err;
+} ;
+
+typedef err_t (*tcpip_api_call_fn)(struct tcpip_api_call_data* call);
+
+err_t tcpip_api_call(tcpip_api_call_fn fn, struct tcpip_api_call_data* call) {
+    host_in_tcpip_thread = true;
+    err_t err = fn(call);
+    host_in_tcpip_thread = false;
+    return err;
+}
+
+
+#endif
@@ -0,0 +1,267 @@
+// Extracts the onecall fields on a Linux host with the sketch's JsonPathReader
+// and the JsonField tables of weather_tiny/onecall_fields.h. Checks every
+// WeatherResponse field against the sample payload, checks that the table
+// paths are found in it and times the extraction. With ArduinoJson 6 on the
+// include path the DOM parse the sketch used before (deserializeJson with
+// a filter) is timed alongside on the same payload.
+//
+// Build and run from the repository root:
+//   g++ -std=c++11 -O2 -I tools/host -I weather_tiny tools/json_host.cpp -o json_host
+//   ./json_host [onecall json, default tools/host/fixtures/onecall.json] [benchmark iterations, default 1000]
+// with the DOM comparison add -I <arduino libraries>/ArduinoJson/src
+//
+// Expected values are those of tools/host/fixtures/onecall.json, update
+// them together with the payload.
+
+#include <math.h>
+#include <set>
+#include <string>
+#include "Arduino.h"
+#include "host_stream.h"
+#include "onecall_fields.h"
+
+#if __has_include(<ArduinoJson.h>)
+#include <ArduinoJson.h>
+#define HAS_ARDUINO_JSON 1
+#else
+#define HAS_ARDUINO_JSON 0
+#endif
+
+
+static int failed_cnt = 0;
+
+
+void report(bool ok, const char* name, const std::string& detail) {
+    if (!ok) {
+        printf("%-36s FAILED %s\n", name, detail.c_str());
+        failed_cnt++;
+    }
+}
+
+
+void check_int(int actual, int expected, const char* name) {
+    report(actual == expected, name, std::to_string(actual) + " instead of " + std::to_string(expected));
+}
+
+
+void check_float(float actual, float expected, const char* name) {
+    report(fabs(actual - expected) < 0.001f, name, std::to_string(actual) + " instead of " + std::to_string(expected));
+}
+
+
+void check_text(const char* actual, const char* expected, const char* name) {
+    report(strcmp(actual, expected) == 0, name, std::string("\"") + actual + "\" instead of \"" + expected + "\"");
+}
+
+
+std::string read_file(const char* path) {
+    FILE* f = fopen(path, "rb");
+    if (!f) {
+        fprintf(stderr, "Cannot read %s\n", path);
+        exit(1);
+    }
+    std::string content;
+    char buffer[4096];
+    for (size_t n; (n = fread(buffer, 1, sizeof(buffer), f)) > 0; ) {
+        content.append(buffer, n);
+    }
+    fclose(f);
+    return content;
+}
+
+
+bool extract(const std::string& json, WeatherResponse& weather) {
+    HostStream stream(json);
+    JsonPathReader reader(stream);
+    weather = WeatherResponse();
+    return reader.read(weather_value_visitor, &weather);
+}
+
+
+void check_fields(const WeatherResponse& weather) {
+    check_int(weather.timezone_offset, 7200, "timezone_offset");
+    check_int(weather.hourly[0].date_ts, 1657627631, "hourly[0].date_ts");
+    check_int(weather.hourly[0].sunr_ts, 1657592457, "hourly[0].sunr_ts");
+    check_int(weather.hourly[0].suns_ts, 1657651883, "hourly[0].suns_ts");
+    check_int(weather.hourly[0].temp, 27, "hourly[0].temp");
+    check_int(weather.hourly[0].feel_t, 27, "hourly[0].feel_t");
+    check_int(weather.hourly[0].pressure, 1012, "hourly[0].pressure");
+    check_int(weather.hourly[0].clouds, 40, "hourly[0].clouds");
+    check_int(weather.hourly[0].wind_bft, 3, "hourly[0].wind_bft");
+    check_int(weather.hourly[0].wind_deg, 250, "hourly[0].wind_deg");
+    check_text(weather.hourly[0].icon, "10", "hourly[0].icon");
+    check_text(weather.hourly[0].descr, "słabe opady deszczu", "hourly[0].descr");
+    check_float(weather.hourly[0].rain, 0.21f, "hourly[0].rain");
+    check_float(weather.hourly[0].snow, 0.0f, "hourly[0].snow");
+    check_int(weather.hourly[0].max_t, 28, "hourly[0].max_t");
+    check_int(weather.hourly[0].min_t, 16, "hourly[0].min_t");
+    check_int(weather.hourly[0].pop, 12, "hourly[0].pop");
+    check_int(weather.daily[0].date_ts, 1657713600, "daily[0].date_ts");
+    check_int(weather.daily[0].max_t, 28, "daily[0].max_t");
+    check_int(weather.daily[0].min_t, 17, "daily[0].min_t");
+    check_int(weather.daily[0].wind_bft, 4, "daily[0].wind_bft");
+    check_int(weather.daily[0].wind_deg, 271, "daily[0].wind_deg");
+    check_int(weather.daily[0].pop, 45, "daily[0].pop");
+    check_float(weather.daily[0].rain, 1.99f, "daily[0].rain");
+    check_float(weather.daily[0].snow, 0.0f, "daily[0].snow");
+    check_int(weather.daily[1].date_ts, 1657800000, "daily[1].date_ts");
+    check_int(weather.daily[1].max_t, 27, "daily[1].max_t");
+    check_int(weather.daily[1].min_t, 17, "daily[1].min_t");
+    check_int(weather.daily[1].wind_bft, 2, "daily[1].wind_bft");
+    check_int(weather.daily[1].wind_deg, 258, "daily[1].wind_deg");
+    check_int(weather.daily[1].pop, 51, "daily[1].pop");
+    check_float(weather.daily[1].rain, 0.0f, "daily[1].rain");
+    check_float(weather.daily[1].snow, 0.0f, "daily[1].snow");
+    check_int(weather.rain[0].date_ts, 1657630800, "rain[0].date_ts");
+    check_int(weather.rain[0].pop, 12, "rain[0].pop");
+    check_float(weather.rain[0].rain, 0.0f, "rain[0].rain");
+    check_float(weather.rain[0].snow, 0.0f, "rain[0].snow");
+    check_float(weather.rain[0].feel_t, 26.2f, "rain[0].feel_t");
+    check_text(weather.rain[0].icon, "04", "rain[0].icon");
+    check_int(weather.rain[1].date_ts, 1657634400, "rain[1].date_ts");
+    check_int(weather.rain[1].pop, 46, "rain[1].pop");
+    check_float(weather.rain[1].rain, 3.04f, "rain[1].rain");
+    check_float(weather.rain[1].snow, 0.0f, "rain[1].snow");
+    check_float(weather.rain[1].feel_t, 25.1f, "rain[1].feel_t");
+    check_text(weather.rain[1].icon, "10", "rain[1].icon");
+    check_int(weather.rain[2].date_ts, 1657638000, "rain[2].date_ts");
+    check_int(weather.rain[2].pop, 78, "rain[2].pop");
+    check_float(weather.rain[2].rain, 0.55f, "rain[2].rain");
+    check_float(weather.rain[2].snow, 0.0f, "rain[2].snow");
+    check_float(weather.rain[2].feel_t, 24.7f, "rain[2].feel_t");
+    check_text(weather.rain[2].icon, "10", "rain[2].icon");
+    check_int(weather.rain[3].date_ts, 1657641600, "rain[3].date_ts");
+    check_int(weather.rain[3].pop, 96, "rain[3].pop");
+    check_float(weather.rain[3].rain, 1.25f, "rain[3].rain");
+    check_float(weather.rain[3].snow, 0.0f, "rain[3].snow");
+    check_float(weather.rain[3].feel_t, 22.6f, "rain[3].feel_t");
+    check_text(weather.rain[3].icon, "10", "rain[3].icon");
+    check_int(weather.rain[4].date_ts, 1657645200, "rain[4].date_ts");
+    check_int(weather.rain[4].pop, 100, "rain[4].pop");
+    check_float(weather.rain[4].rain, 2.51f, "rain[4].rain");
+    check_float(weather.rain[4].snow, 0.0f, "rain[4].snow");
+    check_float(weather.rain[4].feel_t, 20.8f, "rain[4].feel_t");
+    check_text(weather.rain[4].icon, "11", "rain[4].icon");
+}
+
+
+void collect_path(const char* path, const char*, void* context) {
+    ((std::set<std::string>*) context)->insert(path);
+}
+
+
+// snow is sent only while it snows, the sample has none
+bool is_optional(const char* path) {
+    return strncmp(path, "snow", 4) == 0;
+}
+
+
+// every path of a table has to be in the payload under one of the prefixes
+template<typename T, size_t N>
+void check_paths(const JsonField<T> (&fields)[N], const std::set<std::string>& paths,
+        const char* table, std::initializer_list<const char*> prefixes) {
+    for (size_t i = 0; i < N; i++) {
+        bool found = false;
+        for (const char* prefix : prefixes) {
+            found = found || paths.count(std::string(prefix) + "." + fields[i].path) > 0;
+        }
+        std::string name = std::string(table) + " " + fields[i].path;
+        if (!found && is_optional(fields[i].path)) {
+            printf("%-36s not in the payload (optional)\n", name.c_str());
+            continue;
+        }
+        report(found, name.c_str(), "not in the payload");
+    }
+}
+
+
+template<typename Parse>
+double bench(const char* name, int iterations, Parse parse) {
+    unsigned long start = micros();
+    for (int i = 0; i < iterations; i++) {
+        parse();
+    }
+    double us = (double) (micros() - start) / iterations;
+    printf("  %-34s %9.2f us\n", name, us);
+    return us;
+}
+
+
+#if HAS_ARDUINO_JSON
+// filter and document size of the DOM parse the weather handler used before JsonPathReader
+size_t dom_parse(const std::string& json) {
+    StaticJsonDocument<1024> filter;
+    JsonObject filter_current = filter.createNestedObject("current");
+    for (const char* key : { "dt", "sunrise", "sunset", "temp", "feels_like", "pressure", "clouds", "wind_speed", "wind_deg", "snow", "rain" }) {
+        filter_current[key] = true;
+    }
+    filter_current["weather"][0]["icon"] = true;
+    filter_current["weather"][0]["description"] = true;
+
+    JsonObject filter_hourly = filter["hourly"].createNestedObject();
+    for (const char* key : { "dt", "pop", "feels_like", "snow", "rain" }) {
+        filter_hourly[key] = true;
+    }
+    filter_hourly["weather"][0]["icon"] = true;
+
+    JsonObject filter_daily = filter["daily"].createNestedObject();
+    for (const char* key : { "dt", "wind_speed", "wind_deg", "pop", "snow", "rain" }) {
+        filter_daily[key] = true;
+    }
+    filter_daily["temp"]["max"] = true;
+    filter_daily["temp"]["min"] = true;
+
+    const int hours = 48;
+    const int days = 8;
+    const int json_size = JSON_OBJECT_SIZE(3)
+        + JSON_OBJECT_SIZE(13) + JSON_ARRAY_SIZE(1) + JSON_OBJECT_SIZE(2) + 2 * JSON_OBJECT_SIZE(1)
+        + JSON_ARRAY_SIZE(hours) + hours * (JSON_OBJECT_SIZE(6) + JSON_ARRAY_SIZE(1) + 3 * JSON_OBJECT_SIZE(1))
+        + JSON_ARRAY_SIZE(days) + days * (JSON_OBJECT_SIZE(8) + JSON_OBJECT_SIZE(2))
+        + 1024;
+    DynamicJsonDocument doc(json_size);
+    DeserializationError error = deserializeJson(doc, json.data(), json.size(), DeserializationOption::Filter(filter));
+    return error ? 0 : doc.memoryUsage();
+}
+#endif
+
+
+int main(int argc, char** argv) {
+    const char* fixture = argc > 1 ? argv[1] : "tools/host/fixtures/onecall.json";
+    int iterations = argc > 2 ? atoi(argv[2]) : 1000;
+    const std::string json = read_file(fixture);
+
+    WeatherResponse weather;
+    report(extract(json, weather), "onecall read", "parse error");
+    check_fields(weather);
+
+    std::set<std::string> paths;
+    HostStream stream(json);
+    JsonPathReader reader(stream);
+    reader.read(collect_path, &paths);
+    report(paths.count("timezone_offset") > 0, "timezone_offset", "not in the payload");
+    check_paths(current_weather_fields, paths, "current", { "current" });
+    check_paths(today_weather_fields, paths, "today", { "daily.0" });
+    check_paths(next_hour_weather_fields, paths, "next hour", { "hourly.1" });
+    check_paths(forecast_weather_fields, paths, "forecast", { "daily.1", "daily.2" });
+    check_paths(percip_forecast_fields, paths, "percip", { "hourly.1", "hourly.2", "hourly.3", "hourly.4", "hourly.5" });
+
+    if (iterations > 0) {
+        printf("%u bytes, %d iterations\n", (unsigned) json.size(), iterations);
+        bench("JsonPathReader", iterations, [&]() { extract(json, weather); });
+        printf("  %-34s %9u bytes\n", "reader memory", (unsigned) sizeof(JsonPathReader));
+#if HAS_ARDUINO_JSON
+        size_t used = 0;
+        bench("deserializeJson with filter", iterations, [&]() { used = dom_parse(json); });
+        printf("  %-34s %9u bytes\n", "document memory", (unsigned) used);
+#else
+        printf("  ArduinoJson not on the include path, DOM parse not timed\n");
+#endif
+    }
+
+    if (failed_cnt > 0) {
+        printf("%d checks failed\n", failed_cnt);
+        return 1;
+    }
+    printf("all fields extracted as expected\n");
+    return 0;
+}
@@ -0,0 +1,361 @@
+// Renders the sketch's screens on a Linux host, compares every screen pixel
+// for pixel with its golden PBM image and reports the render time per
+// function. Exits non-zero when a screen differs from its golden image,
+// the rendered screen is then written next to it as <name>.actual.pbm.
+//
+// The weather screens are also drawn the way the sketch drew them through
+// Adafruit GFX before the frame buffer (tools/host/gfx_screen.h). That
+// baseline is timed next to the frame and diffed against the same golden
+// images. Its differences are reported and written as <name>.gfx.pbm, they
+// do not fail the run.
+//
+// Build and run from the repository root:
+//   g++ -std=c++11 -O2 -I tools/host -I weather_tiny tools/render_host.cpp -o render_host
+//   ./render_host [golden directory, default tools/host/golden] [benchmark iterations, default 1000]
+//   ./render_host --update [golden directory]  (after an intended change of the screens)
+//
+// The layout of the weather screen follows the screen size (layout.h). Built
+// with -DSCREEN_WIDTH=296 -DSCREEN_HEIGHT=128 (2.9" panel) or
+// -DSCREEN_WIDTH=400 -DSCREEN_HEIGHT=300 (4.2" panel) only the weather
+// screens are checked, against <name>_<width>x<height>.pbm, with the chrome
+// drawn by render_chrome. chrome_bitmap.h, the config screens and the GFX
+// baseline are made for the sketch's 250x122 panel.
+//
+// The weather screen is the frame sent to the panel, the config and
+// validating screens go through the GxEPD stand-in in tools/host.
+
+#include <stdlib.h>
+#include <vector>
+#include "Arduino.h"
+#include "GxEPD.h"
+
+#ifndef SCREEN_WIDTH
+#define SCREEN_WIDTH   250
+#define SCREEN_HEIGHT  122
+#endif
+#define SKETCH_PANEL (SCREEN_WIDTH == 250 && SCREEN_HEIGHT == 122)
+
+#define SPI_MOSI 23
+#define SPI_MISO -1
+#define SPI_CLK 18
+#define ELINK_SS 5
+
+struct { void begin(int, int, int, int) {} } SPI;
+typedef HostDisplay<SCREEN_WIDTH, SCREEN_HEIGHT> GxEPD_Class;
+GxEPD_Class display;
+
+String openweather_icons[9] = { "01", "02", "03", "04", "09", "10", "11", "13", "50" };
+
+#include "gfx_fonts.h"
+#include "display.h"
+#include "render.h"
+#if SKETCH_PANEL
+#include "chrome_bitmap.h"
+#include "gfx_screen.h"
+#endif
+
+
+static ScreenFrame frame;
+static const char* golden_dir = "tools/host/golden";
+static int iterations = 1000;
+static bool update_golden = false;
+static int mismatch_cnt = 0;
+
+
+// View shown on the first wake, before anything was fetched
+View empty_view() {
+    return View();
+}
+
+
+View summer_view() {
+    View view;
+    view.location = "Krakow";
+    view.datetime = "14:05 Sat 12/07";
+    view.battery_percent = 81;
+    view.weather_icon = "B";
+    view.weather_desc = "Clear sky";
+    view.temp_curr = " 27";
+    view.temp_high = "Hi 29";
+    view.temp_low = "Lo 16";
+    view.temp_feel = "Fl 28";
+    view.pressure = "1018";
+    view.wind = " 2";
+    view.wind_deg = 250;
+    view.aq_pm25 = " 12";
+    const char* hours[PERCIP_SIZE] = { "15", "16", "17", "18", "19" };
+    for (int i = 0; i < PERCIP_SIZE; i++) {
+        view.percip_time[i] = hours[i];
+        view.percip_icon[i] = i < 3 ? "B" : "H";
+        view.percip[i] = " 27";
+        view.percic_pop[i] = i < 3 ? "  0%" : " 10%";
+    }
+    return view;
+}
+
+
+// Stale data, charging battery, the widest values of every field
+View winter_view() {
+    View view;
+    view.location = "Zakopane";
+    view.datetime = "23:59!Wed 31/12";
+    view.battery_percent = 110;
+    view.weather_icon = "W";
+    view.weather_desc = "Heavy shower snow";
+    view.temp_curr = "-18";
+    view.temp_high = "Hi-12";
+    view.temp_low = "Lo-24";
+    view.temp_feel = "Fl-27";
+    view.pressure = " 987";
+    view.wind = "11";
+    view.wind_deg = 45;
+    view.aq_pm25 = "312";
+    const char* hours[PERCIP_SIZE] = { "00", "01", "02", "03", "04" };
+    for (int i = 0; i < PERCIP_SIZE; i++) {
+        view.percip_time[i] = hours[i];
+        view.percip_icon[i] = "W";
+        view.percip[i] = "12.5";
+        view.percic_pop[i] = "100%";
+    }
+    return view;
+}
+
+
+typedef bool (*PixelFn)(int x, int y);
+
+
+String golden_path(const char* name, const char* suffix) {
+    return String(golden_dir) + "/" + name + suffix;
+}
+
+
+void write_pbm(const String& path, PixelFn pixel) {
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) {
+        fprintf(stderr, "Cannot write %s\n", path.c_str());
+        exit(1);
+    }
+    fprintf(f, "P4\n%d %d\n", SCREEN_WIDTH, SCREEN_HEIGHT);
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+        uint8_t byte = 0;
+        for (int x = 0; x < SCREEN_WIDTH; x++) {
+            byte |= pixel(x, y) << (7 - x % 8);
+            if (x % 8 == 7 || x == SCREEN_WIDTH - 1) {
+                fputc(byte, f);
+                byte = 0;
+            }
+        }
+    }
+    fclose(f);
+}
+
+
+// Pixels of a P4 image of the screen size, black is true. False when the
+// file is missing or not such an image.
+bool read_pbm(const String& path, std::vector<bool>& pixels) {
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) {
+        return false;
+    }
+    int width = 0, height = 0;
+    bool ok = fscanf(f, "P4 %d %d", &width, &height) == 2 && fgetc(f) != EOF
+        && width == SCREEN_WIDTH && height == SCREEN_HEIGHT;
+    const int row_bytes = (SCREEN_WIDTH + 7) / 8;
+    pixels.assign(SCREEN_WIDTH * SCREEN_HEIGHT, false);
+
+    for (int y = 0; ok && y < SCREEN_HEIGHT; y++) {
+        uint8_t row[row_bytes];
+        ok = fread(row, 1, row_bytes, f) == (size_t) row_bytes;
+        for (int x = 0; ok && x < SCREEN_WIDTH; x++) {
+            pixels[y * SCREEN_WIDTH + x] = row[x / 8] & (0x80 >> (x % 8));
+        }
+    }
+    fclose(f);
+    return ok;
+}
+
+
+int count_diff(const std::vector<bool>& golden, PixelFn pixel, int& first_x, int& first_y) {
+    int diff_cnt = 0;
+    first_x = first_y = -1;
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+        for (int x = 0; x < SCREEN_WIDTH; x++) {
+            if (pixel(x, y) != golden[y * SCREEN_WIDTH + x]) {
+                if (diff_cnt++ == 0) {
+                    first_x = x;
+                    first_y = y;
+                }
+            }
+        }
+    }
+    return diff_cnt;
+}
+
+
+void check_snapshot(const char* name, PixelFn pixel) {
+    String path = golden_path(name, ".pbm");
+    if (update_golden) {
+        write_pbm(path, pixel);
+        printf("%s written\n", path.c_str());
+        return;
+    }
+    std::vector<bool> golden;
+    if (!read_pbm(path, golden)) {
+        printf("%s: no golden image %s\n", name, path.c_str());
+        mismatch_cnt++;
+        return;
+    }
+    int first_x, first_y;
+    int diff_cnt = count_diff(golden, pixel, first_x, first_y);
+    if (diff_cnt == 0) {
+        printf("%s: matches the golden image\n", name);
+        return;
+    }
+    String actual = golden_path(name, ".actual.pbm");
+    write_pbm(actual, pixel);
+    printf("%s: %d pixels differ, first at (%d, %d), rendered screen in %s\n",
+        name, diff_cnt, first_x, first_y, actual.c_str());
+    mismatch_cnt++;
+}
+
+
+// Baseline screen against the golden image of the frame, only reported
+void diff_baseline(const char* name, PixelFn pixel) {
+    std::vector<bool> golden;
+    if (update_golden || !read_pbm(golden_path(name, ".pbm"), golden)) {
+        return;
+    }
+    int first_x, first_y;
+    int diff_cnt = count_diff(golden, pixel, first_x, first_y);
+    if (diff_cnt == 0) {
+        printf("%s: gfx baseline matches the golden image\n", name);
+        return;
+    }
+    String baseline = golden_path(name, ".gfx.pbm");
+    write_pbm(baseline, pixel);
+    printf("%s: gfx baseline differs in %d pixels, first at (%d, %d), drawn in %s\n",
+        name, diff_cnt, first_x, first_y, baseline.c_str());
+}
+
+
+bool frame_pixel(int x, int y) {
+    return frame.get_pixel(x, y);
+}
+
+
+bool display_pixel(int x, int y) {
+    return display.pixel(x, y);
+}
+
+
+template<typename Render>
+void bench(const char* name, Render render) {
+    if (iterations <= 0) {
+        return;
+    }
+    unsigned long start = micros();
+    for (int i = 0; i < iterations; i++) {
+        render();
+    }
+    printf("  %-24s %8.2f us\n", name, (double) (micros() - start) / iterations);
+}
+
+
+#if SKETCH_PANEL
+void gfx_weather_screen(View& view) {
+    display.fillScreen(GxEPD_WHITE);
+    display_header(view);
+    display_weather(view);
+    display_air_quality(view);
+}
+
+
+void load_chrome() {
+    frame.load(chrome_bitmap);
+}
+#else
+void load_chrome() {
+    frame.clear();
+    render_chrome(frame);
+}
+#endif
+
+
+void weather_screen(const char* name, View view) {
+    String golden_name = name;
+#if !SKETCH_PANEL
+    golden_name += String("_") + SCREEN_WIDTH + "x" + SCREEN_HEIGHT;
+#endif
+    load_chrome();
+    render_header(frame, view);
+    render_weather(frame, view);
+    render_air_quality(frame, view);
+    check_snapshot(golden_name.c_str(), frame_pixel);
+
+#if SKETCH_PANEL
+    gfx_weather_screen(view);
+    diff_baseline(name, display_pixel);
+
+    bench("frame.load", [&]() { frame.load(chrome_bitmap); });
+#endif
+    bench("render_chrome", [&]() { frame.clear(); render_chrome(frame); });
+    bench("render_header", [&]() { render_header(frame, view); });
+    bench("render_weather", [&]() { render_weather(frame, view); });
+    bench("render_air_quality", [&]() { render_air_quality(frame, view); });
+    bench("whole frame", [&]() {
+        load_chrome();
+        render_header(frame, view);
+        render_weather(frame, view);
+        render_air_quality(frame, view);
+    });
+#if SKETCH_PANEL
+    bench("gfx display_header", [&]() { display_header(view); });
+    bench("gfx display_weather", [&]() { display_weather(view); });
+    bench("gfx display_air_quality", [&]() { display_air_quality(view); });
+    bench("gfx whole screen", [&]() { gfx_weather_screen(view); });
+#endif
+}
+
+
+int main(int argc, char** argv) {
+    int arg = 1;
+    if (arg < argc && strcmp(argv[arg], "--update") == 0) {
+        update_golden = true;
+        iterations = 0;
+        arg++;
+    }
+    if (arg < argc) {
+        golden_dir = argv[arg++];
+    }
+    if (arg < argc) {
+        iterations = atoi(argv[arg++]);
+    }
+
+    weather_screen("weather_empty", empty_view());
+    weather_screen("weather_summer", summer_view());
+    weather_screen("weather_winter", winter_view());
+
+#if SKETCH_PANEL
+    init_display();
+    display_config_mode("weather-tiny", "12345678", "192.168.4.1");
+    check_snapshot("config_mode", display_pixel);
+    bench("display_config_mode", []() {
+        display.fillScreen(GxEPD_WHITE);
+        display_config_mode("weather-tiny", "12345678", "192.168.4.1");
+    });
+
+    display.fillScreen(GxEPD_WHITE);
+    display_validating_mode();
+    check_snapshot("validating_mode", display_pixel);
+    bench("display_validating_mode", []() {
+        display.fillScreen(GxEPD_WHITE);
+        display_validating_mode();
+    });
+#endif
+
+    if (mismatch_cnt > 0) {
+        printf("%d screens differ from their golden images\n", mismatch_cnt);
+        return 1;
+    }
+    return 0;
+}
@@ -4,6 +4,5 @@
 #define POSITIONSTACK_KEY "aaaaaa"
 #define WAQI_KEY "bbbbbb"
 #define OPENWEATHER_KEY "ccccc"
-#define TIMEZDB_KEY "dddddd"
 
 #endif
@@ -14,6 +14,12 @@ struct Request {
     String server = "";
     String api_key = "";
     String path = "";
+    int content_length = -1;  // -1 when unknown (ex. chunked response)
+    bool use_circuit_breaker = false;  // skip the endpoint for some wakes after it keeps failing
+    bool accept_gzip = false;  // ask for a compressed body, handler must inflate it
+    bool gzip_encoded = false;  // set when the response body is gzip
+    bool chunked = false;  // set when the response body comes in chunks (HTTP/1.1)
+    int location_id = 0;  // location the response belongs to
     ResponseHandler handler;
 
     void make_path() {}
@@ -24,46 +30,6 @@ struct Request {
 } ;
 
 
-struct TimeZoneDbResponse {
-    time_t dt;
-    int gmt_offset;
-    int dst;
-
-    void print() {
-        struct tm* ti;  // timeinfo
-        ti = localtime(&dt);        
-        Serial.printf(
-            "Date and time:  %d:%d %d, %d-%d-%d \n", 
-            ti->tm_hour, ti->tm_min, ti->tm_wday, 
-            ti->tm_mday, ti->tm_mon+1, 1900+ti->tm_year
-        );
-    }
-} ;
-
-
-struct TimeZoneDbRequest: Request {
-
-    explicit TimeZoneDbRequest(): Request() {
-        this->server = "api.timezonedb.com";
-        this->api_key = TIMEZDB_KEY;
-    }
-
-    explicit TimeZoneDbRequest(String server, String api_key) {
-        this->server = server;
-        this->api_key = api_key;
-    }
-    
-    void make_path(Location& location) {
-        this->path = "/v2.1/get-time-zone?key=" + api_key + "&format=json&by=position&lat=" + String(location.lat) + "&lng=" + String(location.lon);
-    }
-
-    explicit TimeZoneDbRequest(const Request& request): Request(request) { }
-
-    
-    TimeZoneDbResponse response;
-} ;
-
-
 struct AirQualityResponse {
     int pm25;
     
@@ -79,6 +45,7 @@ struct AirQualityRequest: Request {
     explicit AirQualityRequest(): Request() {
         this->server = "api.waqi.info";
         this->api_key = WAQI_KEY;
+        this->use_circuit_breaker = true;
     } 
 
     explicit AirQualityRequest(String server, String api_key) {
@@ -126,13 +93,17 @@ struct GeocodingNominatimRequest: Request {
     explicit GeocodingNominatimRequest(const Request& request): Request(request) { }
 
     void make_path() {
-        this->path = "/v1/forward?access_key=" + api_key + "&query=" + name;
+        this->path = "/v1/forward?access_key=" + api_key + "&limit=1&query=" + name;
     }
     
     GeocodingNominatimResponse response;
 } ;
 
 
+#define ICON_SIZE 3  // 2 digit openweather icon code
+#define DESCR_SIZE 48
+
+
 struct WeatherResponseHourly {  // current and hourly
     int date_ts;
     int sunr_ts; // sunrise
@@ -145,15 +116,15 @@ struct WeatherResponseHourly {  // current and hourly
     int clouds;
     int wind_bft; // round from float to bft int
     int wind_deg; // round from float
-    String icon;
-    String descr;
+    char icon[ICON_SIZE];
+    char descr[DESCR_SIZE];
     float snow;
     float rain;
     int pop; // [hourly] probability of percipitation hourly round to int percent
     
     void print() {
         char buffer[150];
-        Serial.println("Weather currently: " + descr);        
+        Serial.println(String("Weather currently: ") + descr);
         // 15 * 8 char strings
         sprintf(
             buffer, 
@@ -166,7 +137,7 @@ struct WeatherResponseHourly {  // current and hourly
         sprintf(
             buffer, 
             "%8s %8s %8s %8d %8d %8d %8d %8d %8d %8d %8d %8s %8.1f %8.1f %8d",
-            ts2HM(date_ts), ts2HM(sunr_ts), ts2HM(suns_ts), 
+            ts2HM(date_ts).c_str(), ts2HM(sunr_ts).c_str(), ts2HM(suns_ts).c_str(),
             temp, feel_t, max_t, min_t,
             pressure, clouds, wind_bft, wind_deg,
             icon, snow, rain, pop
@@ -215,7 +186,7 @@ struct WeatherResponseRainHourly {
     float feel_t;
     float snow;
     float rain;
-    String icon;
+    char icon[ICON_SIZE];
 
     void print() {
         char buffer[60];
@@ -237,11 +208,32 @@ struct WeatherResponseRainHourly {
 } ;
 
 
+// Plain data without pointers, can be kept in RTC memory
+struct WeatherResponse {
+    int timezone_offset;  // seconds from utc, dst included
+    WeatherResponseHourly hourly[1];
+    WeatherResponseDaily daily[2];
+    WeatherResponseRainHourly rain[5];
+
+    void print() {
+        hourly[0].print();
+        daily[0].print();
+        daily[1].print();
+
+        for (int hour = 0; hour < 5; hour++) {
+            rain[hour].print();
+        }
+    }
+} ;
+
+
 struct WeatherRequest: Request {
    
     explicit WeatherRequest(): Request() {
         this->server = "api.openweathermap.org";
         this->api_key = OPENWEATHER_KEY;
+        this->use_circuit_breaker = true;
+        this->accept_gzip = true;
     }
     
     explicit WeatherRequest(String server, String api_key) {
@@ -251,17 +243,17 @@ struct WeatherRequest: Request {
     
     explicit WeatherRequest(const Request& request): Request(request) { }
 
-    void make_path(Location& location) {
+    // with_daily false leaves the daily block out, today's max and min temperature
+    // and the forecast days then come from the cached response
+    void make_path(Location& location, bool with_daily = true) {
         this->path = "/data/2.5/onecall?lat="+String(location.lat)
             +"&lon="+String(location.lon)
-            +"&exclude=minutely,alerts"
+            +(with_daily ? "&exclude=minutely,alerts" : "&exclude=minutely,alerts,daily")
             +"&appid="+api_key
             +"&lang="+LANGS[LANG];
     }
     
-    WeatherResponseHourly hourly[1];
-    WeatherResponseDaily daily[2];
-    WeatherResponseRainHourly rain[5];
+    WeatherResponse response;
 } ;
 
 
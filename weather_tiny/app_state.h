@@ -0,0 +1,98 @@
+#ifndef _app_state_h
+#define _app_state_h
+
+#include <Arduino.h>
+#include <stddef.h>
+#include <rom/crc.h>
+#include "config.h"
+
+
+#define APP_STATE_VERSION 1
+#define APP_STATE_KEY "state"  // nvs blob
+#define SSID_SIZE (32 + 1)
+#define PASS_SIZE (64 + 1)
+#define LOCATION_NAME_SIZE 64
+
+
+// Mode, config and current location in one record. It is saved to NVS as
+// a single blob and kept in RTC memory through deep sleep, so that wakes
+// do not open Preferences at all. RTC memory is not kept after power on,
+// a version or crc mismatch sends the sketch back to NVS.
+// The last responses are in response_cache.h.
+struct AppState {
+    uint16_t version;
+    uint8_t mode;
+    uint8_t location_cnt;
+    uint8_t curr_loc;
+    char ssid[SSID_SIZE];
+    char pass[PASS_SIZE];
+    struct {
+        char name[LOCATION_NAME_SIZE];
+        float lat;
+        float lon;
+    } location[MAX_LOCATION_CNT];
+    uint32_t crc;  // of everything above
+} ;
+
+RTC_DATA_ATTR struct AppState app_state;
+
+
+uint32_t app_state_crc(const AppState& state) {
+    return crc32_le(0, (const uint8_t*) &state, offsetof(AppState, crc));
+}
+
+
+bool is_app_state_valid() {
+    return app_state.version == APP_STATE_VERSION && app_state.crc == app_state_crc(app_state);
+}
+
+
+void invalidate_app_state() {
+    app_state.version = 0;
+}
+
+
+// ssid and pass always fit (802.11 limits), location names are cut
+void copy_to(char* dst, size_t size, const String& src) {
+    if (src.length() >= size) {
+        Serial.println("Cut to " + String(size - 1) + " characters: " + src);
+    }
+    strncpy(dst, src.c_str(), size - 1);
+}
+
+
+void store_app_state(int mode, const WifiCredentials& wifi, const Location* location, int location_cnt, int curr_loc) {
+    memset(&app_state, 0, sizeof(app_state));  // padding takes part in the crc
+    app_state.mode = mode;
+    app_state.location_cnt = location_cnt;
+    app_state.curr_loc = curr_loc;
+
+    copy_to(app_state.ssid, SSID_SIZE, wifi.ssid);
+    copy_to(app_state.pass, PASS_SIZE, wifi.pass);
+    for (int i = 0; i < MAX_LOCATION_CNT; i++) {
+        copy_to(app_state.location[i].name, LOCATION_NAME_SIZE, location[i].name);
+        app_state.location[i].lat = location[i].lat;
+        app_state.location[i].lon = location[i].lon;
+    }
+    app_state.version = APP_STATE_VERSION;
+    app_state.crc = app_state_crc(app_state);
+}
+
+
+// Config from a valid record, returns the mode
+int load_app_state(WifiCredentials& wifi, Location* location, int& location_cnt, int& curr_loc) {
+    wifi.ssid = app_state.ssid;
+    wifi.pass = app_state.pass;
+    location_cnt = app_state.location_cnt;
+    curr_loc = app_state.curr_loc;
+
+    for (int i = 0; i < MAX_LOCATION_CNT; i++) {
+        location[i].name = app_state.location[i].name;
+        location[i].lat = app_state.location[i].lat;
+        location[i].lon = app_state.location[i].lon;
+    }
+    return app_state.mode;
+}
+
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef _backoff_h
+#define _backoff_h
+
+#include <Arduino.h>
+#include "config.h"
+
+
+#define ENDPOINT_CNT 4
+#define ENDPOINT_HOST_SIZE 32
+
+
+// Failure state of an api host, kept in RTC memory through deep sleep.
+// After repeated failed wakes the circuit opens and the host is skipped
+// for an exponentially growing number of wakes.
+struct EndpointHealth {
+    char host[ENDPOINT_HOST_SIZE];
+    uint8_t failures;  // consecutive failed wakes
+    uint8_t skip_wakes;  // wakes left with the circuit open
+} ;
+
+RTC_DATA_ATTR struct EndpointHealth endpoint_health[ENDPOINT_CNT];
+
+
+// only the main task checks and records circuits, before and after the fetch jobs
+EndpointHealth* endpoint_health_of(const char* host) {
+    EndpointHealth* entry = NULL;
+
+    for (int i = 0; i < ENDPOINT_CNT; i++) {
+        if (strncmp(endpoint_health[i].host, host, ENDPOINT_HOST_SIZE) == 0) {
+            return &endpoint_health[i];
+        }
+        if (entry == NULL && endpoint_health[i].failures == 0 && endpoint_health[i].skip_wakes == 0) {
+            entry = &endpoint_health[i];  // healthy entries carry no state, can be taken over
+        }
+    }
+    if (entry == NULL || strlen(host) >= ENDPOINT_HOST_SIZE) {
+        return NULL;
+    }
+    strcpy(entry->host, host);
+    entry->failures = 0;
+    entry->skip_wakes = 0;
+    return entry;
+}
+
+
+// false while the circuit is open, called once a wake: every call counts as one skipped wake
+bool circuit_allows(const char* host) {
+    bool allowed = true;
+    EndpointHealth* entry = endpoint_health_of(host);
+
+    if (entry != NULL && entry->skip_wakes > 0) {
+        entry->skip_wakes--;
+        allowed = false;
+    }
+    return allowed;
+}
+
+
+// result of the wake, once a wake as well
+void circuit_record(const char* host, bool success) {
+    EndpointHealth* entry = endpoint_health_of(host);
+
+    if (entry != NULL) {
+        if (success) {
+            entry->failures = 0;
+            entry->skip_wakes = 0;
+        } else {
+            if (entry->failures < 255) {
+                entry->failures++;
+            }
+            // 0, 1, 3, 7... wakes, jitter spreads retries of endpoints failing together
+            int skip = (1 << min((int) entry->failures - 1, 7)) - 1;
+            skip += esp_random() % (skip / 2 + 1);
+            entry->skip_wakes = min(skip, CIRCUIT_MAX_SKIP_WAKES);
+        }
+    }
+}
+
+
+// delay before retry attempt within one wake, exponential with jitter
+unsigned long retry_backoff_ms(unsigned int attempt) {
+    unsigned long backoff = RETRY_BACKOFF_BASE_MS << min(attempt - 1, 4u);
+    return backoff + esp_random() % (backoff / 2 + 1);
+}
+
+
+#endif
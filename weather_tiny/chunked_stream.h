@@ -0,0 +1,139 @@
+#ifndef _chunked_stream_h
+#define _chunked_stream_h
+
+#include <Arduino.h>
+
+
+#define CHUNK_SIZE_LINE_MAX 32
+
+
+// Stream adapter decoding a HTTP/1.1 chunked transfer body,
+// "<hex size>[;extension]\r\n<data>\r\n" repeated up to a zero size chunk.
+// Only the data bytes come out, end of stream is reported at the last chunk.
+// Trailers after it are not read, the connection is closed anyway.
+class ChunkedStream : public Stream {
+public:
+    explicit ChunkedStream(Stream& source): _source(source) { }
+
+    int available() override {
+        if (_finished) {
+            return 0;
+        }
+        int available = _source.available();
+        if (_chunk_left > 0) {
+            return min(available, _chunk_left);
+        }
+        return available > 0 ? 1 : 0;
+    }
+
+    int read() override {
+        uint8_t c;
+        return readBytes(&c, 1) == 1 ? c : -1;
+    }
+
+    int peek() override {
+        if (_chunk_left == 0 && !_next_chunk()) {
+            return -1;
+        }
+        return _source.peek();
+    }
+
+    size_t readBytes(char* buffer, size_t length) {
+        size_t count = 0;
+        while (count < length) {
+            if (_chunk_left == 0 && !_next_chunk()) {
+                break;
+            }
+            size_t wanted = min(length - count, (size_t) _chunk_left);
+            size_t got = _source.readBytes(buffer + count, wanted);
+            if (got == 0) {
+                _failed = true;  // body ended inside a chunk
+                _finished = true;
+                break;
+            }
+            _chunk_left -= got;
+            count += got;
+        }
+        return count;
+    }
+
+    size_t readBytes(uint8_t* buffer, size_t length) {
+        return readBytes((char*) buffer, length);
+    }
+
+    size_t write(uint8_t) override {
+        return 0;
+    }
+
+    void flush() override { }
+
+    bool failed() {
+        return _failed;
+    }
+
+
+    private:
+
+    // next byte of the raw body, waits up to the source timeout
+    int _next_source_char() {
+        uint8_t c;
+        if (_source.readBytes(&c, 1) != 1) {
+            return -1;
+        }
+        return c;
+    }
+
+    // reads the size line of the next chunk, false at the last chunk or on error
+    bool _next_chunk() {
+        if (_finished) {
+            return false;
+        }
+        // data of the previous chunk ends with "\r\n"
+        if (_started && (_next_source_char() != '\r' || _next_source_char() != '\n')) {
+            return _fail("Chunk not terminated");
+        }
+        _started = true;
+
+        int size = 0;
+        int digits = 0;
+        int c = _next_source_char();
+
+        for (; isxdigit(c); c = _next_source_char(), digits++) {
+            if (digits == 7) {
+                return _fail("Chunk too large");
+            }
+            size = size * 16 + (isdigit(c) ? c - '0' : tolower(c) - 'a' + 10);
+        }
+        // extensions up to the end of the line are ignored
+        for (int skipped = 0; c >= 0 && c != '\n'; c = _next_source_char()) {
+            if (++skipped > CHUNK_SIZE_LINE_MAX) {
+                return _fail("Chunk size line too long");
+            }
+        }
+        if (c < 0 || digits == 0) {
+            return _fail("No chunk size");
+        }
+        if (size == 0) {
+            _finished = true;
+            return false;
+        }
+        _chunk_left = size;
+        return true;
+    }
+
+    bool _fail(const char* reason) {
+        Serial.println(reason);
+        _failed = true;
+        _finished = true;
+        return false;
+    }
+
+    Stream& _source;
+    int _chunk_left = 0;
+    bool _started = false;
+    bool _finished = false;
+    bool _failed = false;
+} ;
+
+
+#endif
@@ -1,10 +1,66 @@
 #ifndef _config_h
 #define _config_h
 
+#include <time.h>
 #include "api_keys.h"
 
 #define SLEEP_INTERVAL_MIN 15
 
+// the interval adapts to the conditions (wake_schedule.h), wakes stay on
+// round times of the day so every interval has to divide 24 hours
+#define ACTIVE_SLEEP_INTERVAL_MIN 10  // rain on the way or pressure changing fast
+#define NIGHT_SLEEP_INTERVAL_MIN 60
+#define LOW_BATTERY_SLEEP_INTERVAL_MIN 120
+#define LOW_BATTERY_PERCENT 20
+#define PRECIP_POP_THRESHOLD 50  // percent
+#define PRECIP_LOOKAHEAD_HOURS 2
+#define PRESSURE_TREND_HPA 3  // change over 3 hours counted as fast, as in synoptic reports
+#define PRESSURE_TREND_MIN_AGE_MIN 60  // pressure is reported in whole hPa, shorter spans are noise
+#define PRESSURE_TREND_MAX_AGE_MIN 180
+
+#define MAX_LOCATION_CNT 2
+
+// 1 - fetch all api endpoints at once (one FreeRTOS task per request)
+// 0 - fetch one after another (kept for timing comparison)
+#define CONCURRENT_FETCH 1
+#define FETCH_TASK_STACK_SIZE 8192
+
+// reuse last access point, channel and IP lease (static config) instead of scan and DHCP
+#define WIFI_FAST_CONNECT 1
+#define WIFI_FAST_CONNECT_TIMEOUT_MS 3000
+// the static config is dropped for DHCP at half the lease time (when a DHCP
+// client renews), at most after this long and when the lease time is unknown
+#define WIFI_LEASE_MAX_REUSE_MIN (12 * 60)
+
+#define DNS_CACHE_TTL_SEC 3600
+#define DNS_TIMEOUT_MS 3000
+
+#define NTP_SERVER "pool.ntp.org"
+#define CLOCK_SYNC_TIMEOUT_MS 5000  // waited for only when the clock was never set
+
+// failed api requests: retries within a wake wait RETRY_BACKOFF_BASE_MS * 2^n plus jitter,
+// an endpoint failing on consecutive wakes is skipped for up to CIRCUIT_MAX_SKIP_WAKES wakes
+#define REQUEST_RETRY_CNT 3
+#define RETRY_BACKOFF_BASE_MS 250
+#define CIRCUIT_MAX_SKIP_WAKES 8
+
+// responses younger than their ttl are not requested again,
+// onecall carries the current conditions so it goes out on every wake,
+// its daily block only every DAILY_TTL_MIN and when the day changes
+#define WEATHER_TTL_MIN SLEEP_INTERVAL_MIN
+#define DAILY_TTL_MIN (3 * 60)
+#define AIR_QUALITY_TTL_MIN 60  // waqi stations report hourly
+
+// last good responses are shown (marked stale) when an endpoint fails, up to this age
+#define CACHED_RESPONSE_MAX_AGE_MIN (12 * 60)
+
+// a frame changed only in the clock is not sent while the clock on the
+// panel is less behind, the panel then shows the time of its last refresh
+#define MAX_CLOCK_LAG_MIN 90
+
+// cpu clock while waiting for the panel refresh, below 80 the APB and with it the SPI clock slow down too
+#define REFRESH_CPU_FREQ_MHZ 80
+
 
 struct Location {
     String name = "";
@@ -42,4 +98,18 @@ struct WifiCredentials {
 } ;
 
 
+// Last association, kept in RTC memory through deep sleep
+struct WifiLease {
+    bool valid;
+    time_t obtained_ts;  // 0 until the clock is set
+    uint32_t reuse_sec;  // how long the address is used without asking DHCP
+    uint8_t bssid[6];
+    int32_t channel;
+    uint32_t ip;
+    uint32_t gateway;
+    uint32_t subnet;
+    uint32_t dns;
+} ;
+
+
 #endif
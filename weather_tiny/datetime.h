@@ -0,0 +1,56 @@
+#ifndef _datetime_h
+#define _datetime_h
+
+#include <time.h>
+#include "config.h"
+
+
+#define MIN_VALID_TIMESTAMP 1609459200  // 2021-01-01, anything earlier means the clock was never set
+
+
+struct LocalDateTime {
+    time_t dt;  // local time as seconds, use with localtime() (TZ is UTC)
+    int gmt_offset;
+
+    void print() {
+        struct tm* ti;  // timeinfo
+        ti = localtime(&dt);
+        Serial.printf(
+            "Date and time:  %d:%d %d, %d-%d-%d \n",
+            ti->tm_hour, ti->tm_min, ti->tm_wday,
+            ti->tm_mday, ti->tm_mon+1, 1900+ti->tm_year
+        );
+    }
+} ;
+
+
+bool is_clock_set() {
+    return time(NULL) > MIN_VALID_TIMESTAMP;
+}
+
+
+// System clock keeps running through deep sleep, SNTP only corrects the drift.
+// The sync runs in the background while the api requests are made.
+void start_clock_sync() {
+    configTime(0, 0, NTP_SERVER);
+}
+
+
+bool wait_for_clock_sync(unsigned long timeout_ms) {
+    unsigned long start = millis();
+    while (!is_clock_set() && millis() - start < timeout_ms) {
+        delay(10);
+    }
+    return is_clock_set();
+}
+
+
+LocalDateTime local_datetime(int gmt_offset) {
+    LocalDateTime datetime;
+    datetime.gmt_offset = gmt_offset;
+    datetime.dt = time(NULL) + gmt_offset;
+    return datetime;
+}
+
+
+#endif
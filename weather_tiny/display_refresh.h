@@ -0,0 +1,119 @@
+#ifndef _display_refresh_h
+#define _display_refresh_h
+
+#include <GxEPD.h>
+#include <time.h>
+#include "config.h"
+#include "datetime.h"
+#include "panel.h"
+#include "view.h"
+#include "render.h"
+
+
+static_assert(ScreenFrame::SIZE == Panel::BUFFER_SIZE, "frame does not match the panel buffer");
+
+
+// "HH:MM" at the start of the header datetime, left out of the frame hash
+#define CLOCK_CHARS 5
+
+constexpr int CLOCK_LEFT = DATETIME_SLOT.x;
+constexpr int CLOCK_RIGHT = DATETIME_SLOT.x + text_span(font_monofonto10_metrics, CLOCK_CHARS);
+constexpr int CLOCK_TOP = DATETIME_SLOT.baseline - font_monofonto10_metrics.ascent;
+constexpr int CLOCK_BOTTOM = DATETIME_SLOT.baseline + font_monofonto10_metrics.descent;  // exclusive
+
+
+// Last frame on the panel as a hash of its bytes, kept in RTC memory through deep sleep
+struct ViewState {
+    bool valid;
+    uint8_t partial_cnt;  // partial refreshes since the last full one
+    uint8_t skipped_cnt;  // wakes in a row without a refresh
+    uint32_t skipped_total;  // wakes without a refresh since power on
+    uint32_t frame_hash;  // without the clock
+    time_t refreshed_ts;  // time shown by the clock on the panel
+} ;
+
+RTC_DATA_ATTR struct ViewState view_state;
+
+
+// bits of the clock rows within byte i of a native row, white bits are set
+uint8_t clock_mask(int i) {
+    uint8_t mask = 0;
+    for (int bit = 0; bit < 8; bit++) {
+        int y = i * 8 + bit;
+        if (y >= CLOCK_TOP && y < CLOCK_BOTTOM) {
+            mask |= 0x80 >> bit;
+        }
+    }
+    return mask;
+}
+
+
+// fnv-1a over the frame with the clock blanked out
+uint32_t hash_frame(const ScreenFrame& frame) {
+    uint32_t hash = 2166136261u;
+    const uint8_t* bytes = frame.buffer();
+    uint8_t masks[ScreenFrame::ROW_BYTES];
+
+    for (int i = 0; i < ScreenFrame::ROW_BYTES; i++) {
+        masks[i] = clock_mask(i);
+    }
+    for (int row = 0; row < ScreenFrame::ROWS; row++) {
+        int x = ScreenFrame::ROWS - 1 - row;  // native row to screen column
+        bool is_clock = x >= CLOCK_LEFT && x < CLOCK_RIGHT;
+
+        for (int i = 0; i < ScreenFrame::ROW_BYTES; i++) {
+            uint8_t byte = *bytes++;
+            if (is_clock) {
+                byte |= masks[i];
+            }
+            hash = (hash ^ byte) * 16777619u;
+        }
+    }
+    return hash;
+}
+
+
+// next wake in operating mode has to start with a full refresh
+void invalidate_view_state() {
+    view_state.valid = false;
+}
+
+
+// The frame is written to the panel as a whole in its native layout.
+// A changed frame gets a fast (partial) refresh, which leaves ghosting behind,
+// so every Panel::FULL_REFRESH_EVERY refreshes the panel gets a full one.
+// A frame that differs from the one on the panel only in the clock is not
+// sent while the clock on the panel lags less than MAX_CLOCK_LAG_MIN.
+// Returns false when skipped.
+bool refresh_display(ScreenFrame& frame) {
+    unsigned long start = millis();
+    uint32_t frame_hash = hash_frame(frame);
+    bool full = !view_state.valid || view_state.partial_cnt + 1 >= Panel::FULL_REFRESH_EVERY;
+    bool clock_lags = !is_clock_set() || time(NULL) - view_state.refreshed_ts >= MAX_CLOCK_LAG_MIN * 60;
+
+    if (!full && !clock_lags && frame_hash == view_state.frame_hash) {
+        view_state.skipped_cnt++;
+        view_state.skipped_total++;
+        Serial.printf("Frame unchanged, refresh skipped (%u in a row, %u since power on)\n",
+            view_state.skipped_cnt, view_state.skipped_total);
+        return false;
+    }
+
+    if (full) {
+        display.drawBitmap(frame.buffer(), ScreenFrame::SIZE, Panel::FULL_MODE);
+        view_state.partial_cnt = 0;
+        Serial.printf("Full refresh in %lu ms\n", millis() - start);
+    } else {
+        display.drawBitmap(frame.buffer(), ScreenFrame::SIZE, Panel::FAST_MODE);
+        view_state.partial_cnt++;
+        Serial.printf("Partial refresh in %lu ms\n", millis() - start);
+    }
+    view_state.frame_hash = frame_hash;
+    view_state.refreshed_ts = time(NULL);
+    view_state.skipped_cnt = 0;
+    view_state.valid = true;
+    return true;
+}
+
+
+#endif
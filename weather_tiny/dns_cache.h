@@ -0,0 +1,109 @@
+#ifndef _dns_cache_h
+#define _dns_cache_h
+
+#include <Arduino.h>
+#include <time.h>
+#include "config.h"
+
+
+#define DNS_CACHE_SIZE 4
+#define DNS_HOST_SIZE 32
+
+
+// Resolved api hosts, kept in RTC memory through deep sleep.
+// lwip does not hand out the record ttl, DNS_CACHE_TTL_SEC is used for every answer.
+// Lookups go through dns_resolve.h, the cache itself does not depend on lwip.
+struct DnsCacheEntry {
+    char host[DNS_HOST_SIZE];
+    uint32_t ip;
+    time_t expires;
+} ;
+
+RTC_DATA_ATTR struct DnsCacheEntry dns_cache[DNS_CACHE_SIZE];
+portMUX_TYPE dns_cache_mux = portMUX_INITIALIZER_UNLOCKED;
+
+
+// fetch jobs run in parallel tasks, callers hold dns_cache_mux
+DnsCacheEntry* dns_cache_find(const char* host) {
+    for (int i = 0; i < DNS_CACHE_SIZE; i++) {
+        if (strncmp(dns_cache[i].host, host, DNS_HOST_SIZE) == 0) {
+            return &dns_cache[i];
+        }
+    }
+    return NULL;
+}
+
+
+// callers hold dns_cache_mux, the clock is read before taking it
+bool dns_cache_lookup(const char* host, uint32_t& ip, time_t now) {
+    DnsCacheEntry* entry = dns_cache_find(host);
+    if (entry == NULL || entry->ip == 0 || now >= entry->expires) {
+        return false;
+    }
+    ip = entry->ip;
+    return true;
+}
+
+
+// ip in network byte order as lwip keeps it, IPAddress(ip) for a client
+bool dns_cache_get(const char* host, uint32_t& ip) {
+    time_t now = time(NULL);
+    taskENTER_CRITICAL(&dns_cache_mux);
+    bool found = dns_cache_lookup(host, ip, now);
+    taskEXIT_CRITICAL(&dns_cache_mux);
+    return found;
+}
+
+
+void dns_cache_forget(const char* host) {
+    taskENTER_CRITICAL(&dns_cache_mux);
+    DnsCacheEntry* entry = dns_cache_find(host);
+    if (entry != NULL) {
+        entry->expires = 0;
+    }
+    taskEXIT_CRITICAL(&dns_cache_mux);
+}
+
+
+void dns_cache_put(const char* host, uint32_t ip) {
+    if (strlen(host) >= DNS_HOST_SIZE) {
+        return;
+    }
+    time_t expires = time(NULL) + DNS_CACHE_TTL_SEC;
+    taskENTER_CRITICAL(&dns_cache_mux);
+    DnsCacheEntry* entry = dns_cache_find(host);
+
+    // reuse entry of the same host or the one expiring first
+    if (entry == NULL) {
+        entry = &dns_cache[0];
+        for (int i = 1; i < DNS_CACHE_SIZE; i++) {
+            if (dns_cache[i].expires < entry->expires) {
+                entry = &dns_cache[i];
+            }
+        }
+    }
+    strcpy(entry->host, host);
+    entry->ip = ip;
+    entry->expires = expires;
+    taskEXIT_CRITICAL(&dns_cache_mux);
+}
+
+
+// Hosts without a valid cache entry, at most max_missing of them. Returns their count.
+int dns_cache_misses(const char** hosts, const int host_cnt, const char** missing, const int max_missing) {
+    int missing_cnt = 0;
+    time_t now = time(NULL);
+
+    taskENTER_CRITICAL(&dns_cache_mux);
+    for (int i = 0; i < host_cnt && missing_cnt < max_missing; i++) {
+        uint32_t cached;
+        if (!dns_cache_lookup(hosts[i], cached, now)) {
+            missing[missing_cnt++] = hosts[i];
+        }
+    }
+    taskEXIT_CRITICAL(&dns_cache_mux);
+    return missing_cnt;
+}
+
+
+#endif
@@ -0,0 +1,134 @@
+#ifndef _dns_resolve_h
+#define _dns_resolve_h
+
+#include <WiFi.h>
+#include "lwip/dns.h"
+#include "lwip/priv/tcpip_priv.h"
+#include "dns_cache.h"
+
+
+struct DnsLookup {
+    const char* host;
+    uint32_t ip;
+    EventBits_t done_bit;
+} ;
+
+// not on the stack, an answer arriving after the timeout must still land somewhere valid
+DnsLookup dns_lookups[DNS_CACHE_SIZE];
+EventGroupHandle_t dns_lookup_events = NULL;
+
+// Slots are reused by the next dns_resolve_all, possibly for other hosts.
+// The callback argument carries the call generation next to the slot index,
+// a late answer of an earlier call is dropped instead of landing in a reused slot.
+volatile uint32_t dns_lookup_generation = 0;
+portMUX_TYPE dns_lookup_mux = portMUX_INITIALIZER_UNLOCKED;
+
+#define DNS_LOOKUP_SLOT_BITS 8
+
+
+// generation wraps, only its low bits are compared
+void* dns_lookup_arg(uint32_t generation, int slot) {
+    return (void*) (uintptr_t) ((generation << DNS_LOOKUP_SLOT_BITS) | slot);
+}
+
+
+// runs in the lwip task
+void dns_lookup_found(const char* name, const ip_addr_t* ipaddr, void* callback_arg) {
+    uint32_t arg = (uint32_t) (uintptr_t) callback_arg;
+    int slot = arg & ((1 << DNS_LOOKUP_SLOT_BITS) - 1);
+    bool current = false;
+
+    taskENTER_CRITICAL(&dns_lookup_mux);
+    if (arg == (uint32_t) (uintptr_t) dns_lookup_arg(dns_lookup_generation, slot)) {
+        current = true;
+        if (ipaddr != NULL) {
+            dns_lookups[slot].ip = ipaddr->u_addr.ip4.addr;
+        }
+    }
+    taskEXIT_CRITICAL(&dns_lookup_mux);
+
+    if (current) {
+        xEventGroupSetBits(dns_lookup_events, dns_lookups[slot].done_bit);
+    } else {
+        Serial.printf("DNS late answer for %s dropped\n", name);
+    }
+}
+
+
+// The raw lwip dns api is not thread safe, the query is sent from the tcpip
+// thread that also handles the answers. tcpip_api_call waits until it is sent.
+struct DnsQueryCall {
+    struct tcpip_api_call_data call;  // first, lwip hands back a pointer to it
+    const char* host;
+    void* callback_arg;
+    ip_addr_t addr;
+    err_t err;
+} ;
+
+
+// runs in the lwip task
+err_t dns_query_in_tcpip(struct tcpip_api_call_data* call) {
+    DnsQueryCall* query = (DnsQueryCall*) call;
+    query->err = dns_gethostbyname(query->host, &query->addr, dns_lookup_found, query->callback_arg);
+    return ERR_OK;
+}
+
+
+err_t dns_query(const char* host, ip_addr_t& addr, void* callback_arg) {
+    DnsQueryCall query = {};
+    query.host = host;
+    query.callback_arg = callback_arg;
+    tcpip_api_call(dns_query_in_tcpip, &query.call);
+    addr = query.addr;
+    return query.err;
+}
+
+
+// Resolves all hosts missing in the cache at once, waits for the slowest answer only.
+void dns_resolve_all(const char** hosts, const int host_cnt, unsigned long timeout_ms) {
+    unsigned long start = millis();
+    EventBits_t pending = 0;
+    int lookup_cnt = 0;
+
+    if (dns_lookup_events == NULL) {
+        dns_lookup_events = xEventGroupCreate();
+    }
+    uint32_t generation = dns_lookup_generation;
+    xEventGroupClearBits(dns_lookup_events, (BIT0 << DNS_CACHE_SIZE) - 1);
+
+    const char* missing[DNS_CACHE_SIZE];
+    int missing_cnt = dns_cache_misses(hosts, host_cnt, missing, DNS_CACHE_SIZE);
+
+    for (; lookup_cnt < missing_cnt; lookup_cnt++) {
+        DnsLookup& lookup = dns_lookups[lookup_cnt];
+        lookup.host = missing[lookup_cnt];
+        lookup.ip = 0;
+        lookup.done_bit = BIT0 << lookup_cnt;
+
+        ip_addr_t addr = {};
+        err_t err = dns_query(lookup.host, addr, dns_lookup_arg(generation, lookup_cnt));
+        if (err == ERR_OK) {
+            lookup.ip = addr.u_addr.ip4.addr;
+        } else if (err == ERR_INPROGRESS) {
+            pending |= lookup.done_bit;
+        }
+    }
+    if (pending) {
+        xEventGroupWaitBits(dns_lookup_events, pending, pdFALSE, pdTRUE, pdMS_TO_TICKS(timeout_ms));
+    }
+    // answers still on the way are dropped from here on, the slots go to the next call
+    taskENTER_CRITICAL(&dns_lookup_mux);
+    dns_lookup_generation++;
+    taskEXIT_CRITICAL(&dns_lookup_mux);
+
+    for (int i = 0; i < lookup_cnt; i++) {
+        if (dns_lookups[i].ip != 0) {
+            dns_cache_put(dns_lookups[i].host, dns_lookups[i].ip);
+        }
+        Serial.printf("DNS %s -> %s\n", dns_lookups[i].host, IPAddress(dns_lookups[i].ip).toString().c_str());
+    }
+    Serial.printf("DNS resolved %d of %d hosts in %lu ms\n", lookup_cnt, host_cnt, millis() - start);
+}
+
+
+#endif
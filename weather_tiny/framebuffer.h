@@ -0,0 +1,273 @@
+#ifndef _framebuffer_h
+#define _framebuffer_h
+
+#include <stdint.h>
+#include <string.h>
+
+#ifndef PROGMEM
+#define PROGMEM  // host build, flash and ram are the same
+#endif
+
+
+// Glyph of a font converted by tools/fontgen.py. Metrics are those of the
+// GFXfont glyph, the bitmap is stored column by column (left to right),
+// ceil(height / 8) bytes a column with the top row in the highest bit.
+struct RotatedGlyph {
+    uint16_t offset;
+    uint8_t width;
+    uint8_t height;
+    uint8_t x_advance;
+    int8_t x_offset;
+    int8_t y_offset;
+} ;
+
+// FrameBuffer::_blit shifts a glyph column of at most 5 bytes within a 64 bit
+// word, taller glyphs are not drawn. Checked by tools/fontgen.py and arrowgen.cpp.
+#define MAX_GLYPH_HEIGHT 40
+
+
+struct RotatedFont {
+    const uint8_t* bitmap;
+    const RotatedGlyph* glyphs;
+    uint8_t first;
+    uint8_t last;
+    uint8_t y_advance;
+} ;
+
+
+// Compile time metrics of a font, advance is the same for every glyph of a monospace font
+struct FontMetrics {
+    int advance;  // of '0'
+    int cap_height;  // rows of '0' above the baseline
+    int ascent;  // rows of the tallest glyph kept in the font above the baseline
+    int descent;  // rows of the deepest glyph kept in the font below the baseline
+    int line_height;
+} ;
+
+
+// 1 bit per pixel frame in the panel's own memory layout, white bits set.
+// Drawing takes screen coordinates of the landscape view (GxEPD rotation 3),
+// the panel keeps the screen turned by 90 degrees:
+//   native row = WIDTH - 1 - x, native column = y
+// so a screen column is a run of bits in one native row and glyphs stored
+// column by column are cleared in a few bytes at a time (black is 0).
+template<int WIDTH, int HEIGHT>
+class FrameBuffer {
+public:
+    static const int ROW_BYTES = (HEIGHT + 7) / 8;
+    static const int ROWS = WIDTH;
+    static const int SIZE = ROW_BYTES * ROWS;
+
+    void clear() {
+        memset(_buffer, 0xFF, SIZE);
+    }
+
+    // bitmap in the same layout, SIZE bytes
+    void load(const uint8_t* bitmap) {
+        memcpy(_buffer, bitmap, SIZE);
+    }
+
+    const uint8_t* buffer() const {
+        return _buffer;
+    }
+
+    uint8_t* buffer() {
+        return _buffer;
+    }
+
+    void set_pixel(int x, int y) {
+        if (x < 0 || x >= WIDTH || y < 0 || y >= HEIGHT) {
+            return;
+        }
+        _row(x)[y / 8] &= ~(0x80 >> (y % 8));
+    }
+
+    bool get_pixel(int x, int y) const {
+        if (x < 0 || x >= WIDTH || y < 0 || y >= HEIGHT) {
+            return false;
+        }
+        return !(_buffer[(WIDTH - 1 - x) * ROW_BYTES + y / 8] & (0x80 >> (y % 8)));
+    }
+
+    void fill_rect(int x, int y, int w, int h) {
+        if (x < 0) { w += x; x = 0; }
+        if (y < 0) { h += y; y = 0; }
+        if (x + w > WIDTH) { w = WIDTH - x; }
+        if (y + h > HEIGHT) { h = HEIGHT - y; }
+        if (w <= 0 || h <= 0) {
+            return;
+        }
+        for (int col = x; col < x + w; col++) {
+            _clear_run(_row(col), y, h);
+        }
+    }
+
+    void draw_rect(int x, int y, int w, int h) {
+        fill_rect(x, y, w, 1);
+        fill_rect(x, y + h - 1, w, 1);
+        fill_rect(x, y, 1, h);
+        fill_rect(x + w - 1, y, 1, h);
+    }
+
+    // corners cut along a circle of radius r, as Adafruit GFX fillRoundRect
+    void fill_round_rect(int x, int y, int w, int h, int r) {
+        int max_r = (w < h ? w : h) / 2;
+        if (r > max_r) {
+            r = max_r;
+        }
+        for (int i = 0; i < w; i++) {
+            int dx = 0;
+            if (i < r) {
+                dx = r - i;
+            } else if (i >= w - r) {
+                dx = i - (w - 1 - r);
+            }
+            int inset = 0;
+            while (inset < r && (r - inset) * (r - inset) + dx * dx > r * r) {
+                inset++;
+            }
+            fill_rect(x + i, y + inset, 1, h - 2 * inset);
+        }
+    }
+
+    // same scan conversion as Adafruit GFX fillTriangle
+    void fill_triangle(int x0, int y0, int x1, int y1, int x2, int y2) {
+        if (y0 > y1) { _swap(y0, y1); _swap(x0, x1); }
+        if (y1 > y2) { _swap(y2, y1); _swap(x2, x1); }
+        if (y0 > y1) { _swap(y0, y1); _swap(x0, x1); }
+
+        if (y0 == y2) {
+            int a = x0, b = x0;
+            if (x1 < a) a = x1; else if (x1 > b) b = x1;
+            if (x2 < a) a = x2; else if (x2 > b) b = x2;
+            fill_rect(a, y0, b - a + 1, 1);
+            return;
+        }
+        int dx01 = x1 - x0, dy01 = y1 - y0;
+        int dx02 = x2 - x0, dy02 = y2 - y0;
+        int dx12 = x2 - x1, dy12 = y2 - y1;
+        int32_t sa = 0, sb = 0;
+        int last = y1 == y2 ? y1 : y1 - 1;
+        int y = y0;
+
+        for (; y <= last; y++) {
+            int a = x0 + sa / dy01;
+            int b = x0 + sb / dy02;
+            sa += dx01;
+            sb += dx02;
+            if (a > b) _swap(a, b);
+            fill_rect(a, y, b - a + 1, 1);
+        }
+        sa = (int32_t) dx12 * (y - y1);
+        sb = (int32_t) dx02 * (y - y0);
+
+        for (; y <= y2; y++) {
+            int a = x1 + sa / dy12;
+            int b = x0 + sb / dy02;
+            sa += dx12;
+            sb += dx02;
+            if (a > b) _swap(a, b);
+            fill_rect(a, y, b - a + 1, 1);
+        }
+    }
+
+    // Draws glyph number index of the font with its origin at (x, y)
+    void draw_glyph(int x, int y, const RotatedFont& font, int index) {
+        const RotatedGlyph& glyph = font.glyphs[index];
+        _blit(x + glyph.x_offset, y + glyph.y_offset, glyph, font.bitmap + glyph.offset);
+    }
+
+    // Draws text with its baseline at (x, baseline), returns the cursor advance.
+    // Characters missing in the font are skipped, as Adafruit GFX does.
+    int draw_text(int x, int baseline, const RotatedFont& font, const char* text) {
+        int cursor = x;
+        for (const uint8_t* c = (const uint8_t*) text; *c; c++) {
+            if (*c < font.first || *c > font.last) {
+                continue;
+            }
+            const RotatedGlyph& glyph = font.glyphs[*c - font.first];
+            _blit(cursor + glyph.x_offset, baseline + glyph.y_offset, glyph, font.bitmap + glyph.offset);
+            cursor += glyph.x_advance;
+        }
+        return cursor - x;
+    }
+
+
+    private:
+
+    uint8_t* _row(int x) {
+        return _buffer + (WIDTH - 1 - x) * ROW_BYTES;
+    }
+
+    static void _swap(int& a, int& b) {
+        int t = a;
+        a = b;
+        b = t;
+    }
+
+    // clears length bits from bit y on, bits are msb first within a byte
+    static void _clear_run(uint8_t* row, int y, int length) {
+        int byte = y / 8;
+        int bit = y % 8;
+
+        if (bit + length <= 8) {
+            row[byte] &= ~((0xFF >> bit) & (0xFF << (8 - bit - length)));
+            return;
+        }
+        row[byte++] &= ~(0xFF >> bit);
+        length -= 8 - bit;
+
+        for (; length >= 8; length -= 8) {
+            row[byte++] = 0x00;
+        }
+        if (length > 0) {
+            row[byte] &= ~(0xFF << (8 - length));
+        }
+    }
+
+    // One glyph column at a time: up to 5 column bytes are aligned in a
+    // 64 bit word and cleared from the row with byte wide operations.
+    void _blit(int x, int y, const RotatedGlyph& glyph, const uint8_t* bits) {
+        if (glyph.height > MAX_GLYPH_HEIGHT) {
+            return;
+        }
+        const int column_bytes = (glyph.height + 7) / 8;
+        int skip = y < 0 ? -y : 0;  // rows above the screen
+        int height = glyph.height;
+
+        if (y + height > HEIGHT) {
+            height = HEIGHT - y;
+        }
+        height -= skip;
+        if (height <= 0) {
+            return;
+        }
+        int top = y + skip;
+        int shift = top % 8;
+        int first_byte = top / 8;
+        int byte_cnt = (shift + height + 7) / 8;
+        uint64_t keep = ~0ULL << (64 - height);
+
+        for (int col = 0; col < glyph.width; col++, bits += column_bytes) {
+            int screen_x = x + col;
+            if (screen_x < 0 || screen_x >= WIDTH) {
+                continue;
+            }
+            uint64_t word = 0;
+            for (int i = 0; i < column_bytes; i++) {
+                word |= (uint64_t) bits[i] << (56 - 8 * i);
+            }
+            word = ((word << skip) & keep) >> shift;
+
+            uint8_t* row = _row(screen_x) + first_byte;
+            for (int i = 0; i < byte_cnt; i++) {
+                row[i] &= ~(uint8_t) (word >> (56 - 8 * i));
+            }
+        }
+    }
+
+    uint8_t _buffer[SIZE];
+} ;
+
+
+#endif
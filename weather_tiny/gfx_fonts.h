@@ -0,0 +1,370 @@
+// Generated by tools/fontgen.py --gfx, do not edit.
+#ifndef _gfx_fonts_h
+#define _gfx_fonts_h
+
+
+// monofonto10pt7b from Monofonto10pt.h, 15 of 95 glyphs
+const uint8_t monofonto10pt7bBitmaps[] PROGMEM = {
+  0x00, 0xFC, 0xE1, 0xD8, 0x67, 0x19, 0xCE, 0x73, 0x8C, 0xC3, 0x30, 0xFC,
+  0x3F, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x03, 0x00, 0x3E, 0x7F, 0xE7, 0x03,
+  0x7F, 0xFF, 0xE3, 0xE7, 0xFF, 0x7B, 0x1E, 0x7F, 0xF2, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xF2, 0x7F, 0x3E, 0x03, 0x03, 0x03, 0x03, 0x73, 0xFB, 0xE7, 0xC7,
+  0xC3, 0xC3, 0xC7, 0xE7, 0xFB, 0x73, 0x1F, 0x3F, 0x38, 0x30, 0xFE, 0xFE,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3B, 0x7B, 0xE7, 0xC7,
+  0xC3, 0xC3, 0xC7, 0xE7, 0x7B, 0x3B, 0x03, 0xC7, 0xFE, 0x7C, 0x30, 0xC3,
+  0x00, 0xF3, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0xFF, 0xF0, 0xFF, 0xCE, 0x73,
+  0x9C, 0xE7, 0x39, 0xCE, 0x73, 0x9C, 0xCE, 0xDF, 0xE7, 0xE3, 0xC3, 0xC3,
+  0xC3, 0xC3, 0xC3, 0xC3, 0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7,
+  0x7E, 0x3C, 0xCE, 0xDF, 0xE6, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0x30, 0x30, 0x30, 0xFE, 0xFE, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x3F,
+  0x1F, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0x7E, 0x3C,
+};
+
+const GFXglyph monofonto10pt7bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  10,   0,    0 },  // 0x20 ' '
+  {     0,   0,   0,  10,   0,    0 },  // 0x21 '!'
+  {     0,   0,   0,  10,   0,    0 },  // 0x22 '"'
+  {     0,   0,   0,  10,   0,    0 },  // 0x23 '#'
+  {     0,   0,   0,  10,   0,    0 },  // 0x24 '$'
+  {     0,   0,   0,  10,   0,    0 },  // 0x25 '%'
+  {     0,   0,   0,  10,   0,    0 },  // 0x26 '&'
+  {     0,   0,   0,  10,   0,    0 },  // 0x27 "'"
+  {     0,   0,   0,  10,   0,    0 },  // 0x28 '('
+  {     0,   0,   0,  10,   0,    0 },  // 0x29 ')'
+  {     0,   0,   0,  10,   0,    0 },  // 0x2A '*'
+  {     0,   0,   0,  10,   0,    0 },  // 0x2B '+'
+  {     0,   0,   0,  10,   0,    0 },  // 0x2C ','
+  {     0,   0,   0,  10,   0,    0 },  // 0x2D '-'
+  {     1,   2,   3,  10,   4,   -2 },  // 0x2E '.'
+  {     0,   0,   0,  10,   0,    0 },  // 0x2F '/'
+  {     0,   0,   0,  10,   0,    0 },  // 0x30 '0'
+  {     0,   0,   0,  10,   0,    0 },  // 0x31 '1'
+  {     0,   0,   0,  10,   0,    0 },  // 0x32 '2'
+  {     0,   0,   0,  10,   0,    0 },  // 0x33 '3'
+  {     0,   0,   0,  10,   0,    0 },  // 0x34 '4'
+  {     0,   0,   0,  10,   0,    0 },  // 0x35 '5'
+  {     0,   0,   0,  10,   0,    0 },  // 0x36 '6'
+  {     0,   0,   0,  10,   0,    0 },  // 0x37 '7'
+  {     0,   0,   0,  10,   0,    0 },  // 0x38 '8'
+  {     0,   0,   0,  10,   0,    0 },  // 0x39 '9'
+  {     0,   0,   0,  10,   0,    0 },  // 0x3A ':'
+  {     0,   0,   0,  10,   0,    0 },  // 0x3B ';'
+  {     0,   0,   0,  10,   0,    0 },  // 0x3C '<'
+  {     0,   0,   0,  10,   0,    0 },  // 0x3D '='
+  {     0,   0,   0,  10,   0,    0 },  // 0x3E '>'
+  {     0,   0,   0,  10,   0,    0 },  // 0x3F '?'
+  {     0,   0,   0,  10,   0,    0 },  // 0x40 '@'
+  {     0,   0,   0,  10,   0,    0 },  // 0x41 'A'
+  {     0,   0,   0,  10,   0,    0 },  // 0x42 'B'
+  {     0,   0,   0,  10,   0,    0 },  // 0x43 'C'
+  {     0,   0,   0,  10,   0,    0 },  // 0x44 'D'
+  {     0,   0,   0,  10,   0,    0 },  // 0x45 'E'
+  {     0,   0,   0,  10,   0,    0 },  // 0x46 'F'
+  {     0,   0,   0,  10,   0,    0 },  // 0x47 'G'
+  {     0,   0,   0,  10,   0,    0 },  // 0x48 'H'
+  {     0,   0,   0,  10,   0,    0 },  // 0x49 'I'
+  {     0,   0,   0,  10,   0,    0 },  // 0x4A 'J'
+  {     0,   0,   0,  10,   0,    0 },  // 0x4B 'K'
+  {     0,   0,   0,  10,   0,    0 },  // 0x4C 'L'
+  {     0,   0,   0,  10,   0,    0 },  // 0x4D 'M'
+  {     0,   0,   0,  10,   0,    0 },  // 0x4E 'N'
+  {     0,   0,   0,  10,   0,    0 },  // 0x4F 'O'
+  {     0,   0,   0,  10,   0,    0 },  // 0x50 'P'
+  {     0,   0,   0,  10,   0,    0 },  // 0x51 'Q'
+  {     0,   0,   0,  10,   0,    0 },  // 0x52 'R'
+  {     0,   0,   0,  10,   0,    0 },  // 0x53 'S'
+  {     0,   0,   0,  10,   0,    0 },  // 0x54 'T'
+  {     0,   0,   0,  10,   0,    0 },  // 0x55 'U'
+  {     2,  10,  14,  10,   0,  -13 },  // 0x56 'V'
+  {     0,   0,   0,  10,   0,    0 },  // 0x57 'W'
+  {     0,   0,   0,  10,   0,    0 },  // 0x58 'X'
+  {     0,   0,   0,  10,   0,    0 },  // 0x59 'Y'
+  {     0,   0,   0,  10,   0,    0 },  // 0x5A 'Z'
+  {     0,   0,   0,  10,   0,    0 },  // 0x5B '['
+  {     0,   0,   0,  10,   0,    0 },  // 0x5C '\\'
+  {     0,   0,   0,  10,   0,    0 },  // 0x5D ']'
+  {     0,   0,   0,  10,   0,    0 },  // 0x5E '^'
+  {     0,   0,   0,  10,   0,    0 },  // 0x5F '_'
+  {     0,   0,   0,  10,   0,    0 },  // 0x60 '`'
+  {    20,   8,  10,  10,   1,   -9 },  // 0x61 'a'
+  {     0,   0,   0,  10,   0,    0 },  // 0x62 'b'
+  {    30,   8,  10,  10,   1,   -9 },  // 0x63 'c'
+  {    40,   8,  14,  10,   1,  -13 },  // 0x64 'd'
+  {     0,   0,   0,  10,   0,    0 },  // 0x65 'e'
+  {    54,   8,  14,  10,   1,  -13 },  // 0x66 'f'
+  {    68,   8,  14,  10,   1,   -9 },  // 0x67 'g'
+  {     0,   0,   0,  10,   0,    0 },  // 0x68 'h'
+  {    82,   6,  14,  10,   2,  -13 },  // 0x69 'i'
+  {     0,   0,   0,  10,   0,    0 },  // 0x6A 'j'
+  {     0,   0,   0,  10,   0,    0 },  // 0x6B 'k'
+  {    93,   5,  14,  10,   2,  -13 },  // 0x6C 'l'
+  {     0,   0,   0,  10,   0,    0 },  // 0x6D 'm'
+  {   102,   8,  10,  10,   1,   -9 },  // 0x6E 'n'
+  {   112,   8,  10,  10,   1,   -9 },  // 0x6F 'o'
+  {     0,   0,   0,  10,   0,    0 },  // 0x70 'p'
+  {     0,   0,   0,  10,   0,    0 },  // 0x71 'q'
+  {   122,   8,  10,  10,   1,   -9 },  // 0x72 'r'
+  {     0,   0,   0,  10,   0,    0 },  // 0x73 's'
+  {   132,   8,  13,  10,   1,  -12 },  // 0x74 't'
+  {   145,   8,  10,  10,   1,   -9 },  // 0x75 'u'
+};
+
+const GFXfont monofonto10pt7b PROGMEM = { (uint8_t *) monofonto10pt7bBitmaps, (GFXglyph *) monofonto10pt7bGlyphs, 0x20, 0x75, 24 };
+
+
+// monofonto18pt7b from Monofonto18pt.h, 7 of 95 glyphs
+const uint8_t monofonto18pt7bBitmaps[] PROGMEM = {
+  0x7B, 0xDE, 0xF7, 0xBD, 0xEF, 0x7B, 0xDE, 0xF7, 0xBD, 0xEF, 0x78, 0x00,
+  0x07, 0x3F, 0xFF, 0x7B, 0x80, 0xF8, 0x07, 0xBC, 0x07, 0xDE, 0x03, 0xEF,
+  0x01, 0xF7, 0x80, 0xFB, 0xC4, 0x7D, 0xE2, 0x3C, 0xF9, 0x9E, 0x7C, 0xCF,
+  0x3E, 0xE7, 0x8F, 0x73, 0xC7, 0xBD, 0xE3, 0xDE, 0xF1, 0xFF, 0xF8, 0xFF,
+  0xF8, 0x7F, 0xFC, 0x3F, 0xFE, 0x1F, 0xBF, 0x07, 0xDF, 0x83, 0xE7, 0xC1,
+  0xF3, 0xE0, 0xF9, 0xF0, 0x78, 0xF0, 0x3C, 0x78, 0x1E, 0x1C, 0x0F, 0x0E,
+  0x00, 0x03, 0xF0, 0x1F, 0xF8, 0x7F, 0xF9, 0xFF, 0xE7, 0xE1, 0x8F, 0x80,
+  0x1E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x03, 0xC0, 0x07,
+  0xC0, 0x8F, 0xC3, 0x8F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFC, 0x07, 0xE0, 0x07,
+  0xE0, 0x3F, 0xE0, 0xFF, 0xE3, 0xFF, 0xE7, 0xC3, 0xCF, 0x03, 0xFE, 0x07,
+  0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xC0, 0x07, 0x81, 0x0F,
+  0x87, 0xDF, 0xFF, 0x1F, 0xFE, 0x1F, 0xF8, 0x0F, 0xC0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0xF7,
+  0x1C, 0xFF, 0xBE, 0xFF, 0xFE, 0xFF, 0xFF, 0xF3, 0x9F, 0xF3, 0x9F, 0xF3,
+  0x9F, 0xF3, 0x9F, 0xF3, 0x9F, 0xF3, 0x9F, 0xF3, 0x9F, 0xF3, 0x9F, 0xF3,
+  0x9F, 0xF3, 0x9F, 0xF3, 0x9F, 0xF3, 0x9F, 0xF3, 0x9F, 0xF3, 0x9F, 0x07,
+  0xC0, 0x3F, 0xE0, 0xFF, 0xE1, 0xFF, 0xE7, 0xC7, 0xCF, 0x07, 0xDE, 0x07,
+  0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7B, 0xC0, 0xF7, 0x83, 0xEF,
+  0x8F, 0x8F, 0xFF, 0x1F, 0xFC, 0x1F, 0xF0, 0x0F, 0x80,
+};
+
+const GFXglyph monofonto18pt7bGlyphs[] PROGMEM = {
+  {     0,   5,  26,  18,   6,  -25 },  // 0x21 '!'
+  {     0,   0,   0,  18,   0,    0 },  // 0x22 '"'
+  {     0,   0,   0,  18,   0,    0 },  // 0x23 '#'
+  {     0,   0,   0,  18,   0,    0 },  // 0x24 '$'
+  {     0,   0,   0,  18,   0,    0 },  // 0x25 '%'
+  {     0,   0,   0,  18,   0,    0 },  // 0x26 '&'
+  {     0,   0,   0,  18,   0,    0 },  // 0x27 "'"
+  {     0,   0,   0,  18,   0,    0 },  // 0x28 '('
+  {     0,   0,   0,  18,   0,    0 },  // 0x29 ')'
+  {     0,   0,   0,  18,   0,    0 },  // 0x2A '*'
+  {     0,   0,   0,  18,   0,    0 },  // 0x2B '+'
+  {     0,   0,   0,  18,   0,    0 },  // 0x2C ','
+  {     0,   0,   0,  18,   0,    0 },  // 0x2D '-'
+  {     0,   0,   0,  18,   0,    0 },  // 0x2E '.'
+  {     0,   0,   0,  18,   0,    0 },  // 0x2F '/'
+  {     0,   0,   0,  18,   0,    0 },  // 0x30 '0'
+  {     0,   0,   0,  18,   0,    0 },  // 0x31 '1'
+  {     0,   0,   0,  18,   0,    0 },  // 0x32 '2'
+  {     0,   0,   0,  18,   0,    0 },  // 0x33 '3'
+  {     0,   0,   0,  18,   0,    0 },  // 0x34 '4'
+  {     0,   0,   0,  18,   0,    0 },  // 0x35 '5'
+  {     0,   0,   0,  18,   0,    0 },  // 0x36 '6'
+  {     0,   0,   0,  18,   0,    0 },  // 0x37 '7'
+  {     0,   0,   0,  18,   0,    0 },  // 0x38 '8'
+  {     0,   0,   0,  18,   0,    0 },  // 0x39 '9'
+  {     0,   0,   0,  18,   0,    0 },  // 0x3A ':'
+  {     0,   0,   0,  18,   0,    0 },  // 0x3B ';'
+  {     0,   0,   0,  18,   0,    0 },  // 0x3C '<'
+  {     0,   0,   0,  18,   0,    0 },  // 0x3D '='
+  {     0,   0,   0,  18,   0,    0 },  // 0x3E '>'
+  {     0,   0,   0,  18,   0,    0 },  // 0x3F '?'
+  {     0,   0,   0,  18,   0,    0 },  // 0x40 '@'
+  {     0,   0,   0,  18,   0,    0 },  // 0x41 'A'
+  {     0,   0,   0,  18,   0,    0 },  // 0x42 'B'
+  {     0,   0,   0,  18,   0,    0 },  // 0x43 'C'
+  {     0,   0,   0,  18,   0,    0 },  // 0x44 'D'
+  {     0,   0,   0,  18,   0,    0 },  // 0x45 'E'
+  {     0,   0,   0,  18,   0,    0 },  // 0x46 'F'
+  {     0,   0,   0,  18,   0,    0 },  // 0x47 'G'
+  {     0,   0,   0,  18,   0,    0 },  // 0x48 'H'
+  {     0,   0,   0,  18,   0,    0 },  // 0x49 'I'
+  {     0,   0,   0,  18,   0,    0 },  // 0x4A 'J'
+  {     0,   0,   0,  18,   0,    0 },  // 0x4B 'K'
+  {     0,   0,   0,  18,   0,    0 },  // 0x4C 'L'
+  {     0,   0,   0,  18,   0,    0 },  // 0x4D 'M'
+  {     0,   0,   0,  18,   0,    0 },  // 0x4E 'N'
+  {     0,   0,   0,  18,   0,    0 },  // 0x4F 'O'
+  {     0,   0,   0,  18,   0,    0 },  // 0x50 'P'
+  {     0,   0,   0,  18,   0,    0 },  // 0x51 'Q'
+  {     0,   0,   0,  18,   0,    0 },  // 0x52 'R'
+  {     0,   0,   0,  18,   0,    0 },  // 0x53 'S'
+  {     0,   0,   0,  18,   0,    0 },  // 0x54 'T'
+  {     0,   0,   0,  18,   0,    0 },  // 0x55 'U'
+  {     0,   0,   0,  18,   0,    0 },  // 0x56 'V'
+  {    17,  17,  26,  18,   0,  -25 },  // 0x57 'W'
+  {     0,   0,   0,  18,   0,    0 },  // 0x58 'X'
+  {     0,   0,   0,  18,   0,    0 },  // 0x59 'Y'
+  {     0,   0,   0,  18,   0,    0 },  // 0x5A 'Z'
+  {     0,   0,   0,  18,   0,    0 },  // 0x5B '['
+  {     0,   0,   0,  18,   0,    0 },  // 0x5C '\\'
+  {     0,   0,   0,  18,   0,    0 },  // 0x5D ']'
+  {     0,   0,   0,  18,   0,    0 },  // 0x5E '^'
+  {     0,   0,   0,  18,   0,    0 },  // 0x5F '_'
+  {     0,   0,   0,  18,   0,    0 },  // 0x60 '`'
+  {     0,   0,   0,  18,   0,    0 },  // 0x61 'a'
+  {     0,   0,   0,  18,   0,    0 },  // 0x62 'b'
+  {    73,  15,  18,  18,   1,  -17 },  // 0x63 'c'
+  {     0,   0,   0,  18,   0,    0 },  // 0x64 'd'
+  {   107,  15,  18,  18,   1,  -17 },  // 0x65 'e'
+  {     0,   0,   0,  18,   0,    0 },  // 0x66 'f'
+  {     0,   0,   0,  18,   0,    0 },  // 0x67 'g'
+  {     0,   0,   0,  18,   0,    0 },  // 0x68 'h'
+  {     0,   0,   0,  18,   0,    0 },  // 0x69 'i'
+  {     0,   0,   0,  18,   0,    0 },  // 0x6A 'j'
+  {     0,   0,   0,  18,   0,    0 },  // 0x6B 'k'
+  {   141,   8,  26,  18,   4,  -25 },  // 0x6C 'l'
+  {   167,  16,  18,  18,   1,  -17 },  // 0x6D 'm'
+  {     0,   0,   0,  18,   0,    0 },  // 0x6E 'n'
+  {   203,  15,  18,  18,   1,  -17 },  // 0x6F 'o'
+};
+
+const GFXfont monofonto18pt7b PROGMEM = { (uint8_t *) monofonto18pt7bBitmaps, (GFXglyph *) monofonto18pt7bGlyphs, 0x21, 0x6F, 42 };
+
+
+// Cousine_Regular6pt7b from Cousine6pt.h, 95 of 95 glyphs
+const uint8_t Cousine_Regular6pt7bBitmaps[] PROGMEM = {
+  0x00, 0xFD, 0xB6, 0xD0, 0x24, 0x49, 0xF9, 0x44, 0x9F, 0x92, 0x24, 0x10,
+  0xF9, 0x52, 0x83, 0x82, 0x84, 0xEA, 0x7C, 0x20, 0xE5, 0x4A, 0xA7, 0x81,
+  0xE5, 0x52, 0xA7, 0x38, 0x90, 0xA1, 0x86, 0x52, 0xB2, 0x3B, 0xF0, 0x2B,
+  0x49, 0x24, 0xC8, 0x80, 0x89, 0x92, 0x49, 0x6A, 0x00, 0x27, 0x88, 0xA5,
+  0x00, 0x21, 0x09, 0xF2, 0x10, 0x80, 0x69, 0x40, 0xE0, 0xC0, 0x08, 0x44,
+  0x22, 0x31, 0x10, 0x80, 0x74, 0x63, 0x58, 0xC6, 0x2E, 0x23, 0x82, 0x08,
+  0x20, 0x82, 0x3F, 0x74, 0x42, 0x33, 0x22, 0x1F, 0x74, 0x42, 0x60, 0x86,
+  0x2E, 0x11, 0x94, 0xA9, 0x7C, 0x42, 0xFC, 0x21, 0xE0, 0x86, 0x2E, 0x76,
+  0x61, 0xE8, 0xC6, 0x2E, 0xF8, 0x44, 0x22, 0x11, 0x88, 0x74, 0x62, 0xE8,
+  0xC6, 0x2E, 0x74, 0x63, 0x17, 0x86, 0x6E, 0xC6, 0x50, 0x16, 0x80, 0x0B,
+  0xA0, 0xE0, 0x80, 0xF8, 0x01, 0xF0, 0x83, 0x82, 0xE8, 0x00, 0xF4, 0x42,
+  0x33, 0x10, 0x04, 0x38, 0x89, 0x0C, 0xFA, 0xB5, 0x6A, 0xDE, 0x40, 0x88,
+  0xE0, 0x10, 0x50, 0xA1, 0x44, 0x4F, 0x91, 0x41, 0xF2, 0x28, 0xBC, 0x8A,
+  0x38, 0xBE, 0x72, 0x28, 0x20, 0x82, 0x0C, 0x9E, 0xF4, 0xE3, 0x18, 0xC6,
+  0x7E, 0xFC, 0x21, 0xF8, 0x42, 0x1F, 0xFC, 0x21, 0xF8, 0x42, 0x10, 0x74,
+  0x61, 0x09, 0xC6, 0x2F, 0x8C, 0x63, 0xF8, 0xC6, 0x31, 0xF9, 0x08, 0x42,
+  0x10, 0x9F, 0x38, 0xC6, 0x31, 0x8E, 0x4E, 0x8A, 0x4A, 0x38, 0xA2, 0x48,
+  0xA3, 0x84, 0x21, 0x08, 0x42, 0x1F, 0x8E, 0xF7, 0xBA, 0xC6, 0x31, 0x8E,
+  0x73, 0x5A, 0xCE, 0x71, 0x74, 0x63, 0x18, 0xC6, 0x2E, 0xF4, 0x63, 0x1F,
+  0x42, 0x10, 0x74, 0x63, 0x18, 0xC6, 0x2E, 0x30, 0xC0, 0xFA, 0x28, 0xBC,
+  0x92, 0x48, 0xA2, 0x39, 0x14, 0x1C, 0x0C, 0x14, 0x5F, 0xFE, 0x20, 0x40,
+  0x81, 0x02, 0x04, 0x08, 0x8C, 0x63, 0x18, 0xC6, 0x2E, 0x82, 0x89, 0x12,
+  0x22, 0x85, 0x0A, 0x08, 0x83, 0x06, 0x4A, 0xA6, 0xCD, 0x9B, 0x36, 0x44,
+  0xD8, 0xA0, 0x83, 0x85, 0x11, 0x22, 0xC6, 0x88, 0xA0, 0x81, 0x02, 0x04,
+  0x08, 0x7C, 0x08, 0x20, 0x83, 0x04, 0x10, 0x7F, 0xF8, 0x88, 0x88, 0x88,
+  0x88, 0xF0, 0x84, 0x10, 0xC2, 0x18, 0x41, 0x08, 0xF1, 0x11, 0x11, 0x11,
+  0x11, 0xF0, 0x22, 0x95, 0x18, 0x80, 0xFE, 0x44, 0x72, 0x60, 0xBE, 0x8A,
+  0x6E, 0xC0, 0x84, 0x2D, 0x98, 0xC6, 0x39, 0xB0, 0x74, 0x61, 0x08, 0x45,
+  0xC0, 0x08, 0x5B, 0x38, 0xC6, 0x33, 0x68, 0x74, 0x63, 0xF8, 0x45, 0xC0,
+  0x3A, 0x3E, 0x84, 0x21, 0x08, 0x40, 0x6C, 0xE3, 0x18, 0xCD, 0xA1, 0x70,
+  0x84, 0x2D, 0x98, 0xC6, 0x31, 0x88, 0x20, 0x0E, 0x08, 0x20, 0x82, 0x08,
+  0xFC, 0x10, 0xF1, 0x11, 0x11, 0x13, 0xE0, 0x84, 0x23, 0x2A, 0x72, 0x52,
+  0x88, 0xE1, 0x08, 0x42, 0x10, 0x84, 0xF8, 0xFD, 0x6B, 0x5A, 0xD6, 0xA0,
+  0xB6, 0x63, 0x18, 0xC6, 0x20, 0x74, 0x63, 0x18, 0xC5, 0xC0, 0xB6, 0x63,
+  0x18, 0xE6, 0xD0, 0x80, 0x6C, 0xE3, 0x18, 0xCD, 0xA1, 0x08, 0xBB, 0x10,
+  0x84, 0x21, 0x00, 0x74, 0x70, 0xE0, 0xC5, 0xC0, 0x42, 0x3E, 0x84, 0x21,
+  0x08, 0x78, 0x8C, 0x63, 0x18, 0xCD, 0xA0, 0x44, 0x89, 0x11, 0x42, 0x85,
+  0x04, 0x00, 0x83, 0x06, 0x53, 0x66, 0xCD, 0x93, 0x00, 0x8A, 0x94, 0x45,
+  0x2A, 0x20, 0x44, 0x89, 0x91, 0x42, 0x82, 0x04, 0x18, 0x60, 0xF8, 0x84,
+  0x44, 0x43, 0xE0, 0x39, 0x08, 0x42, 0x60, 0x84, 0x21, 0x0E, 0xFF, 0xE0,
+  0xE1, 0x08, 0x42, 0x0C, 0x84, 0x21, 0x38, 0xE1, 0xC0,
+};
+
+const GFXglyph Cousine_Regular6pt7bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   7,   0,    0 },  // 0x20 ' '
+  {     1,   1,   8,   7,   3,   -7 },  // 0x21 '!'
+  {     2,   3,   4,   7,   2,   -8 },  // 0x22 '"'
+  {     4,   7,   8,   7,   0,   -7 },  // 0x23 '#'
+  {    11,   7,  10,   7,   0,   -8 },  // 0x24 '$'
+  {    20,   7,   8,   7,   0,   -7 },  // 0x25 '%'
+  {    27,   7,   8,   7,   0,   -7 },  // 0x26 '&'
+  {    34,   1,   4,   7,   3,   -8 },  // 0x27 "'"
+  {    35,   3,  11,   7,   2,   -8 },  // 0x28 '('
+  {    40,   3,  11,   7,   2,   -8 },  // 0x29 ')'
+  {    45,   5,   5,   7,   1,   -8 },  // 0x2A '*'
+  {    49,   5,   7,   7,   1,   -7 },  // 0x2B '+'
+  {    54,   3,   4,   7,   1,   -1 },  // 0x2C ','
+  {    56,   3,   1,   7,   2,   -3 },  // 0x2D '-'
+  {    57,   1,   2,   7,   3,   -1 },  // 0x2E '.'
+  {    58,   5,   9,   7,   1,   -8 },  // 0x2F '/'
+  {    64,   5,   8,   7,   1,   -7 },  // 0x30 '0'
+  {    69,   6,   8,   7,   1,   -7 },  // 0x31 '1'
+  {    75,   5,   8,   7,   1,   -7 },  // 0x32 '2'
+  {    80,   5,   8,   7,   1,   -7 },  // 0x33 '3'
+  {    85,   5,   8,   7,   1,   -7 },  // 0x34 '4'
+  {    90,   5,   8,   7,   1,   -7 },  // 0x35 '5'
+  {    95,   5,   8,   7,   1,   -7 },  // 0x36 '6'
+  {   100,   5,   8,   7,   1,   -7 },  // 0x37 '7'
+  {   105,   5,   8,   7,   1,   -7 },  // 0x38 '8'
+  {   110,   5,   8,   7,   1,   -7 },  // 0x39 '9'
+  {   115,   1,   7,   7,   3,   -6 },  // 0x3A ':'
+  {   116,   2,   9,   7,   2,   -6 },  // 0x3B ';'
+  {   119,   5,   5,   7,   1,   -6 },  // 0x3C '<'
+  {   123,   5,   4,   7,   1,   -5 },  // 0x3D '='
+  {   126,   5,   5,   7,   1,   -6 },  // 0x3E '>'
+  {   130,   5,   8,   7,   1,   -7 },  // 0x3F '?'
+  {   135,   7,  11,   7,   0,   -8 },  // 0x40 '@'
+  {   145,   7,   8,   7,   0,   -7 },  // 0x41 'A'
+  {   152,   6,   8,   7,   1,   -7 },  // 0x42 'B'
+  {   158,   6,   8,   7,   1,   -7 },  // 0x43 'C'
+  {   164,   5,   8,   7,   1,   -7 },  // 0x44 'D'
+  {   169,   5,   8,   7,   1,   -7 },  // 0x45 'E'
+  {   174,   5,   8,   7,   1,   -7 },  // 0x46 'F'
+  {   179,   5,   8,   7,   1,   -7 },  // 0x47 'G'
+  {   184,   5,   8,   7,   1,   -7 },  // 0x48 'H'
+  {   189,   5,   8,   7,   1,   -7 },  // 0x49 'I'
+  {   194,   5,   8,   7,   1,   -7 },  // 0x4A 'J'
+  {   199,   6,   8,   7,   1,   -7 },  // 0x4B 'K'
+  {   205,   5,   8,   7,   1,   -7 },  // 0x4C 'L'
+  {   210,   5,   8,   7,   1,   -7 },  // 0x4D 'M'
+  {   215,   5,   8,   7,   1,   -7 },  // 0x4E 'N'
+  {   220,   5,   8,   7,   1,   -7 },  // 0x4F 'O'
+  {   225,   5,   8,   7,   1,   -7 },  // 0x50 'P'
+  {   230,   5,  10,   7,   1,   -7 },  // 0x51 'Q'
+  {   237,   6,   8,   7,   1,   -7 },  // 0x52 'R'
+  {   243,   6,   8,   7,   0,   -7 },  // 0x53 'S'
+  {   249,   7,   8,   7,   0,   -7 },  // 0x54 'T'
+  {   256,   5,   8,   7,   1,   -7 },  // 0x55 'U'
+  {   261,   7,   8,   7,   0,   -7 },  // 0x56 'V'
+  {   268,   7,   8,   7,   0,   -7 },  // 0x57 'W'
+  {   275,   7,   8,   7,   0,   -7 },  // 0x58 'X'
+  {   282,   7,   8,   7,   0,   -7 },  // 0x59 'Y'
+  {   289,   7,   8,   7,   0,   -7 },  // 0x5A 'Z'
+  {   296,   4,  11,   7,   2,   -8 },  // 0x5B '['
+  {   302,   5,   9,   7,   1,   -8 },  // 0x5C '\\'
+  {   308,   4,  11,   7,   1,   -8 },  // 0x5D ']'
+  {   314,   5,   5,   7,   1,   -7 },  // 0x5E '^'
+  {   318,   7,   1,   7,   0,    2 },  // 0x5F '_'
+  {   319,   3,   2,   7,   2,   -9 },  // 0x60 '`'
+  {   320,   6,   7,   7,   1,   -6 },  // 0x61 'a'
+  {   326,   5,   9,   7,   1,   -8 },  // 0x62 'b'
+  {   332,   5,   7,   7,   1,   -6 },  // 0x63 'c'
+  {   337,   5,   9,   7,   1,   -8 },  // 0x64 'd'
+  {   343,   5,   7,   7,   1,   -6 },  // 0x65 'e'
+  {   348,   5,   9,   7,   1,   -8 },  // 0x66 'f'
+  {   354,   5,   9,   7,   1,   -6 },  // 0x67 'g'
+  {   360,   5,   9,   7,   1,   -8 },  // 0x68 'h'
+  {   366,   6,   9,   7,   1,   -8 },  // 0x69 'i'
+  {   373,   4,  11,   7,   1,   -8 },  // 0x6A 'j'
+  {   379,   5,   9,   7,   1,   -8 },  // 0x6B 'k'
+  {   385,   5,   9,   7,   1,   -8 },  // 0x6C 'l'
+  {   391,   5,   7,   7,   1,   -6 },  // 0x6D 'm'
+  {   396,   5,   7,   7,   1,   -6 },  // 0x6E 'n'
+  {   401,   5,   7,   7,   1,   -6 },  // 0x6F 'o'
+  {   406,   5,   9,   7,   1,   -6 },  // 0x70 'p'
+  {   412,   5,   9,   7,   1,   -6 },  // 0x71 'q'
+  {   418,   5,   7,   7,   1,   -6 },  // 0x72 'r'
+  {   423,   5,   7,   7,   1,   -6 },  // 0x73 's'
+  {   428,   5,   9,   7,   1,   -8 },  // 0x74 't'
+  {   434,   5,   7,   7,   1,   -6 },  // 0x75 'u'
+  {   439,   7,   7,   7,   0,   -6 },  // 0x76 'v'
+  {   446,   7,   7,   7,   0,   -6 },  // 0x77 'w'
+  {   453,   5,   7,   7,   1,   -6 },  // 0x78 'x'
+  {   458,   7,   9,   7,   0,   -6 },  // 0x79 'y'
+  {   466,   5,   7,   7,   1,   -6 },  // 0x7A 'z'
+  {   471,   5,  11,   7,   1,   -8 },  // 0x7B '{'
+  {   478,   1,  11,   7,   3,   -8 },  // 0x7C '|'
+  {   480,   5,  11,   7,   1,   -8 },  // 0x7D '}'
+  {   487,   5,   2,   7,   1,   -4 },  // 0x7E '~'
+};
+
+const GFXfont Cousine_Regular6pt7b PROGMEM = { (uint8_t *) Cousine_Regular6pt7bBitmaps, (GFXglyph *) Cousine_Regular6pt7bGlyphs, 0x20, 0x7E, 13 };
+
+
+#endif
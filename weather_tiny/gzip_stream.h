@@ -0,0 +1,229 @@
+#ifndef _gzip_stream_h
+#define _gzip_stream_h
+
+#include <Arduino.h>
+#include "rom/miniz.h"  // tinfl inflater in the esp32 rom
+
+
+#define GZIP_INPUT_BUFFER_SIZE 512
+
+#define GZIP_FLAG_HCRC 0x02
+#define GZIP_FLAG_EXTRA 0x04
+#define GZIP_FLAG_NAME 0x08
+#define GZIP_FLAG_COMMENT 0x10
+
+
+// Stream adapter inflating a gzip body while it arrives.
+// Deflate may refer back up to 32 KB, the history window doubles as the
+// output buffer so nothing but the window is ever held in memory.
+// The trailer crc is not checked, the json parser rejects damaged bodies.
+class GzipStream : public Stream {
+public:
+    explicit GzipStream(Stream& source): _source(source) { }
+
+    ~GzipStream() {
+        free(_inflater);
+        free(_window);
+    }
+
+    int available() override {
+        if (_out_pos < _out_end) {
+            return _out_end - _out_pos;
+        }
+        if (_finished) {
+            return 0;
+        }
+        return _source.available() > 0 || _in_pos < _in_len ? 1 : 0;
+    }
+
+    int read() override {
+        if (_out_pos == _out_end && !_inflate()) {
+            return -1;
+        }
+        return _window[_out_pos++];
+    }
+
+    int peek() override {
+        if (_out_pos == _out_end && !_inflate()) {
+            return -1;
+        }
+        return _window[_out_pos];
+    }
+
+    size_t readBytes(char* buffer, size_t length) {
+        size_t count = 0;
+        while (count < length) {
+            if (_out_pos == _out_end && !_inflate()) {
+                break;
+            }
+            size_t chunk = min(length - count, _out_end - _out_pos);
+            memcpy(buffer + count, _window + _out_pos, chunk);
+            _out_pos += chunk;
+            count += chunk;
+        }
+        return count;
+    }
+
+    size_t readBytes(uint8_t* buffer, size_t length) {
+        return readBytes((char*) buffer, length);
+    }
+
+    size_t write(uint8_t) override {
+        return 0;
+    }
+
+    void flush() override { }
+
+    bool failed() {
+        return _failed;
+    }
+
+    size_t compressed_bytes() {
+        return _compressed_bytes;
+    }
+
+    size_t inflated_bytes() {
+        return _inflated_bytes;
+    }
+
+
+    private:
+
+    // next byte of the compressed body, waits up to the source timeout
+    int _next_input() {
+        if (_in_pos == _in_len && !_fill_input()) {
+            return -1;
+        }
+        return _in_buffer[_in_pos++];
+    }
+
+    bool _fill_input() {
+        int available = _source.available();
+        size_t wanted = available > 0 ? min(available, GZIP_INPUT_BUFFER_SIZE) : 1;
+        _in_len = _source.readBytes(_in_buffer, wanted);
+        _in_pos = 0;
+        _compressed_bytes += _in_len;
+        return _in_len > 0;
+    }
+
+    bool _skip_zero_terminated() {
+        int c;
+        do {
+            c = _next_input();
+        } while (c > 0);
+        return c == 0;
+    }
+
+    bool _read_header() {
+        uint8_t header[10];
+        for (int i = 0; i < 10; i++) {
+            int c = _next_input();
+            if (c < 0) {
+                return false;
+            }
+            header[i] = c;
+        }
+        if (header[0] != 0x1f || header[1] != 0x8b || header[2] != 8) {  // magic, deflate
+            Serial.println("Not a gzip body");
+            return false;
+        }
+        uint8_t flags = header[3];
+
+        if (flags & GZIP_FLAG_EXTRA) {
+            int lo = _next_input();
+            int hi = _next_input();
+            if (lo < 0 || hi < 0) {
+                return false;
+            }
+            for (int extra = lo | (hi << 8); extra > 0; extra--) {
+                if (_next_input() < 0) {
+                    return false;
+                }
+            }
+        }
+        if ((flags & GZIP_FLAG_NAME) && !_skip_zero_terminated()) {
+            return false;
+        }
+        if ((flags & GZIP_FLAG_COMMENT) && !_skip_zero_terminated()) {
+            return false;
+        }
+        if ((flags & GZIP_FLAG_HCRC) && (_next_input() < 0 || _next_input() < 0)) {
+            return false;
+        }
+        return true;
+    }
+
+    bool _begin() {
+        _started = true;
+        _inflater = (tinfl_decompressor*) malloc(sizeof(tinfl_decompressor));
+        _window = (uint8_t*) malloc(TINFL_LZ_DICT_SIZE);
+
+        if (_inflater == NULL || _window == NULL) {
+            Serial.println("No memory for the gzip window");
+            return false;
+        }
+        tinfl_init(_inflater);
+        return _read_header();
+    }
+
+    // inflates the next piece of output into the window, false at the end or on error
+    bool _inflate() {
+        if (!_started && !_begin()) {
+            _failed = true;
+            _finished = true;
+        }
+        while (!_finished) {
+            size_t window_pos = _out_end & (TINFL_LZ_DICT_SIZE - 1);
+
+            if (_status == TINFL_STATUS_NEEDS_MORE_INPUT && _in_pos == _in_len && !_fill_input()) {
+                _failed = true;  // body ended before the last deflate block
+                _finished = true;
+                break;
+            }
+            size_t in_size = _in_len - _in_pos;
+            size_t out_size = TINFL_LZ_DICT_SIZE - window_pos;
+            _status = tinfl_decompress(
+                _inflater, _in_buffer + _in_pos, &in_size,
+                _window, _window + window_pos, &out_size,
+                TINFL_FLAG_HAS_MORE_INPUT
+            );
+            _in_pos += in_size;
+
+            if (_status < TINFL_STATUS_DONE) {
+                Serial.printf("Inflate error %d\n", _status);
+                _failed = true;
+                _finished = true;
+            } else if (_status == TINFL_STATUS_DONE) {
+                _finished = true;
+            }
+            if (out_size > 0) {
+                _out_pos = window_pos;
+                _out_end = window_pos + out_size;
+                _inflated_bytes += out_size;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    Stream& _source;
+
+    uint8_t _in_buffer[GZIP_INPUT_BUFFER_SIZE];
+    size_t _in_pos = 0;
+    size_t _in_len = 0;
+
+    tinfl_decompressor* _inflater = NULL;
+    tinfl_status _status = TINFL_STATUS_NEEDS_MORE_INPUT;
+    uint8_t* _window = NULL;
+    size_t _out_pos = 0;
+    size_t _out_end = 0;
+
+    bool _started = false;
+    bool _finished = false;
+    bool _failed = false;
+    size_t _compressed_bytes = 0;
+    size_t _inflated_bytes = 0;
+} ;
+
+
+#endif
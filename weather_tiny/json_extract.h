@@ -0,0 +1,380 @@
+#ifndef _json_extract_h
+#define _json_extract_h
+
+#include <Arduino.h>
+
+
+#define JSON_EXTRACT_BUFFER_SIZE 128
+#define JSON_EXTRACT_PATH_SIZE 48
+#define JSON_EXTRACT_KEY_SIZE 24
+#define JSON_EXTRACT_VALUE_SIZE 64
+#define JSON_EXTRACT_MAX_DEPTH 16
+
+
+// Called for every scalar in the document, ex. ("hourly.3.weather.0.icon", "04d").
+// Array elements are path segments with their index, null values are not reported.
+typedef void (*JsonValueVisitor) (const char* path, const char* value, void* context);
+
+
+// Single pass pull parser working straight on the stream with fixed size buffers,
+// memory use does not depend on the size of the document.
+class JsonPathReader {
+public:
+    explicit JsonPathReader(Stream& source): _source(source) { }
+
+    // Each read starts on a fresh document, nothing read ahead before is kept
+    bool read(JsonValueVisitor visitor, void* context) {
+        _visitor = visitor;
+        _context = context;
+        _path[0] = '\0';
+        _path_length = 0;
+        _overflow = 0;
+        _pos = 0;
+        _len = 0;
+        _pending = -1;
+        _bytes_read = 0;
+        return _value(_next_non_ws(), 0);
+    }
+
+    size_t bytes_read() {
+        return _bytes_read;
+    }
+
+
+    private:
+
+    int _next() {
+        if (_pending >= 0) {
+            int c = _pending;
+            _pending = -1;
+            return c;
+        }
+        if (_pos == _len) {
+            int available = _source.available();
+            size_t wanted = available > 0 ? min(available, JSON_EXTRACT_BUFFER_SIZE) : 1;
+            _len = _source.readBytes(_buffer, wanted);
+            _pos = 0;
+
+            if (_len == 0) {
+                return -1;
+            }
+        }
+        _bytes_read++;
+        return _buffer[_pos++];
+    }
+
+    int _next_non_ws() {
+        int c = _next();
+        while (c == ' ' || c == '\n' || c == '\r' || c == '\t') {
+            c = _next();
+        }
+        return c;
+    }
+
+    size_t _push(const char* segment) {
+        size_t saved = _path_length;
+        size_t separator = _path_length > 0 ? 1 : 0;
+        size_t length = strlen(segment);
+
+        if (_overflow || _path_length + separator + length >= JSON_EXTRACT_PATH_SIZE) {
+            _overflow++;
+            return saved;
+        }
+        if (separator) {
+            _path[_path_length++] = '.';
+        }
+        memcpy(_path + _path_length, segment, length + 1);
+        _path_length += length;
+        return saved;
+    }
+
+    void _pop(size_t saved) {
+        if (_overflow) {
+            _overflow--;
+            return;
+        }
+        _path_length = saved;
+        _path[_path_length] = '\0';
+    }
+
+    void _visit(const char* value) {
+        if (!_overflow) {
+            _visitor(_path, value, _context);
+        }
+    }
+
+    bool _value(int c, int depth) {
+        if (depth > JSON_EXTRACT_MAX_DEPTH) {
+            return false;
+        }
+        if (c == '{') {
+            return _object(depth + 1);
+        }
+        if (c == '[') {
+            return _array(depth + 1);
+        }
+        if (c == '"') {
+            if (!_string(_value_buffer, JSON_EXTRACT_VALUE_SIZE)) {
+                return false;
+            }
+            _visit(_value_buffer);
+            return true;
+        }
+        return _literal(c);
+    }
+
+    bool _object(int depth) {
+        int c = _next_non_ws();
+        if (c == '}') {
+            return true;
+        }
+        while (true) {
+            if (c != '"' || !_string(_key_buffer, JSON_EXTRACT_KEY_SIZE)) {
+                return false;
+            }
+            if (_next_non_ws() != ':') {
+                return false;
+            }
+            size_t saved = _push(_key_buffer);
+            bool parsed = _value(_next_non_ws(), depth);
+            _pop(saved);
+
+            if (!parsed) {
+                return false;
+            }
+            c = _next_non_ws();
+            if (c == '}') {
+                return true;
+            }
+            if (c != ',') {
+                return false;
+            }
+            c = _next_non_ws();
+        }
+    }
+
+    bool _array(int depth) {
+        int c = _next_non_ws();
+        if (c == ']') {
+            return true;
+        }
+        for (int index = 0; ; index++) {
+            char segment[12];
+            sprintf(segment, "%d", index);
+            size_t saved = _push(segment);
+            bool parsed = _value(c, depth);
+            _pop(saved);
+
+            if (!parsed) {
+                return false;
+            }
+            c = _next_non_ws();
+            if (c == ']') {
+                return true;
+            }
+            if (c != ',') {
+                return false;
+            }
+            c = _next_non_ws();
+        }
+    }
+
+    // reads string after the opening quote, too long strings are truncated
+    bool _string(char* out, const size_t size) {
+        size_t length = 0;
+
+        while (true) {
+            int c = _next();
+            if (c < 0) {
+                return false;
+            }
+            if (c == '"') {
+                break;
+            }
+            if (c == '\\') {
+                c = _next();
+                switch (c) {
+                    case 'b': c = '\b'; break;
+                    case 'f': c = '\f'; break;
+                    case 'n': c = '\n'; break;
+                    case 'r': c = '\r'; break;
+                    case 't': c = '\t'; break;
+                    case 'u': {
+                        char utf8[3];
+                        int bytes = _unicode_escape(utf8);
+                        if (bytes < 0) {
+                            return false;
+                        }
+                        for (int i = 0; i < bytes; i++) {
+                            if (length + 1 < size) {
+                                out[length++] = utf8[i];
+                            }
+                        }
+                        continue;
+                    }
+                    default:
+                        if (c < 0) {
+                            return false;
+                        }
+                        break;  // '"', '\\' and '/' stand for themselves
+                }
+            }
+            if (length + 1 < size) {
+                out[length++] = c;
+            }
+        }
+        out[length] = '\0';
+        return true;
+    }
+
+    // \uXXXX from the basic multilingual plane encoded as utf-8
+    int _unicode_escape(char* utf8) {
+        unsigned int code = 0;
+
+        for (int i = 0; i < 4; i++) {
+            int c = _next();
+            int digit;
+            if (c >= '0' && c <= '9') {
+                digit = c - '0';
+            } else if (c >= 'a' && c <= 'f') {
+                digit = c - 'a' + 10;
+            } else if (c >= 'A' && c <= 'F') {
+                digit = c - 'A' + 10;
+            } else {
+                return -1;
+            }
+            code = (code << 4) | digit;
+        }
+        if (code < 0x80) {
+            utf8[0] = code;
+            return 1;
+        }
+        if (code < 0x800) {
+            utf8[0] = 0xC0 | (code >> 6);
+            utf8[1] = 0x80 | (code & 0x3F);
+            return 2;
+        }
+        utf8[0] = 0xE0 | (code >> 12);
+        utf8[1] = 0x80 | ((code >> 6) & 0x3F);
+        utf8[2] = 0x80 | (code & 0x3F);
+        return 3;
+    }
+
+    // numbers, true, false and null
+    bool _literal(int c) {
+        size_t length = 0;
+
+        while (c >= 0 && c != ',' && c != '}' && c != ']' && c != ' ' && c != '\n' && c != '\r' && c != '\t') {
+            if (length + 1 < JSON_EXTRACT_VALUE_SIZE) {
+                _value_buffer[length++] = c;
+            }
+            c = _next();
+        }
+        _pending = c;
+        _value_buffer[length] = '\0';
+
+        if (length == 0) {
+            return false;
+        }
+        if (strcmp(_value_buffer, "null") != 0) {
+            _visit(_value_buffer);
+        }
+        return true;
+    }
+
+    Stream& _source;
+    JsonValueVisitor _visitor = NULL;
+    void* _context = NULL;
+
+    uint8_t _buffer[JSON_EXTRACT_BUFFER_SIZE];
+    size_t _pos = 0;
+    size_t _len = 0;
+    int _pending = -1;
+    size_t _bytes_read = 0;
+
+    char _path[JSON_EXTRACT_PATH_SIZE];
+    size_t _path_length = 0;
+    int _overflow = 0;
+    char _key_buffer[JSON_EXTRACT_KEY_SIZE];
+    char _value_buffer[JSON_EXTRACT_VALUE_SIZE];
+} ;
+
+
+// Returns the rest of path below "prefix.", NULL if path is not under prefix.
+const char* json_path_under(const char* path, const char* prefix) {
+    size_t length = strlen(prefix);
+    if (strncmp(path, prefix, length) != 0 || path[length] != '.') {
+        return NULL;
+    }
+    return path + length + 1;
+}
+
+
+// Returns the rest of path below "prefix.<index>.", NULL if path is not under an element of prefix.
+const char* json_path_under_index(const char* path, const char* prefix, int* index) {
+    const char* element = json_path_under(path, prefix);
+    if (element == NULL || !isdigit(*element)) {
+        return NULL;
+    }
+    *index = 0;
+    while (isdigit(*element)) {
+        *index = *index * 10 + (*element++ - '0');
+    }
+    if (*element != '.') {
+        return NULL;
+    }
+    return element + 1;
+}
+
+
+// Declarative mapping of a json path to a struct member, ex.
+//   { "wind_deg", assign<WeatherResponseDaily, int, &WeatherResponseDaily::wind_deg> }
+template<typename T>
+struct JsonField {
+    const char* path;
+    void (*assign) (T& target, const char* value);
+} ;
+
+
+inline void parse_json_value(const char* value, int& out) {
+    out = atoi(value);
+}
+
+inline void parse_json_value(const char* value, float& out) {
+    out = strtof(value, NULL);
+}
+
+
+template<typename T, typename V, V T::*member>
+void assign(T& target, const char* value) {
+    parse_json_value(value, target.*member);
+}
+
+
+template<typename T, typename V, V T::*member, V (*convert)(float)>
+void assign_converted(T& target, const char* value) {
+    target.*member = convert(strtof(value, NULL));
+}
+
+
+// fixed size char array member, too long values are truncated
+template<typename T, size_t N, char (T::*member)[N]>
+void assign_text(T& target, const char* value) {
+    strncpy(target.*member, value, N - 1);
+    (target.*member)[N - 1] = '\0';
+}
+
+
+template<typename T, size_t N>
+bool json_assign(const JsonField<T> (&fields)[N], T& target, const char* path, const char* value) {
+    for (size_t i = 0; i < N; i++) {
+        if (strcmp(fields[i].path, path) == 0) {
+            fields[i].assign(target, value);
+            return true;
+        }
+    }
+    return false;
+}
+
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef _json_stream_h
+#define _json_stream_h
+
+#include <Arduino.h>
+
+
+// Stream adapter for json embedded in other bytes (ex. chunked transfer headers).
+// Skips everything up to the first '{' and reports end of stream as soon as
+// the braces balance or content length is reached, so the parser never waits
+// on the stream timeout.
+class EmbeddedJsonStream : public Stream {
+public:
+    explicit EmbeddedJsonStream(Stream& source, int content_length=-1)
+        : _source(source), _content_length(content_length) { }
+
+    int available() override {
+        if (_finished) {
+            return _peeked >= 0 ? 1 : 0;
+        }
+        return _source.available() + (_peeked >= 0 ? 1 : 0);
+    }
+
+    int read() override {
+        if (_peeked >= 0) {
+            int c = _peeked;
+            _peeked = -1;
+            return c;
+        }
+        return _next_json_char();
+    }
+
+    int peek() override {
+        if (_peeked < 0) {
+            _peeked = _next_json_char();
+        }
+        return _peeked;
+    }
+
+    size_t write(uint8_t) override {
+        return 0;
+    }
+
+    void flush() override { }
+
+    size_t json_length() {
+        return _json_length;
+    }
+
+
+    private:
+
+    int _next_source_char() {
+        if (_content_length >= 0 && _consumed >= _content_length) {
+            return -1;
+        }
+        uint8_t c;
+        // waits only while the next byte is still on its way
+        if (_source.readBytes(&c, 1) != 1) {
+            return -1;
+        }
+        _consumed++;
+        return c;
+    }
+
+    int _next_json_char() {
+        if (_finished) {
+            return -1;
+        }
+        int c = _next_source_char();
+
+        while (_depth == 0 && c >= 0 && c != '{') {
+            c = _next_source_char();
+        }
+        if (c < 0) {
+            _finished = true;
+            return -1;
+        }
+        _json_length++;
+
+        if (_in_string) {
+            if (_escaped) {
+                _escaped = false;
+            } else if (c == '\\') {
+                _escaped = true;
+            } else if (c == '"') {
+                _in_string = false;
+            }
+        } else if (c == '"') {
+            _in_string = true;
+        } else if (c == '{' || c == '[') {
+            _depth++;
+        } else if (c == '}' || c == ']') {
+            _depth--;
+            if (_depth == 0) {
+                _finished = true;
+            }
+        }
+        return c;
+    }
+
+    Stream& _source;
+    int _content_length;
+    int _consumed = 0;
+    size_t _json_length = 0;
+    int _depth = 0;
+    int _peeked = -1;
+    bool _in_string = false;
+    bool _escaped = false;
+    bool _finished = false;
+} ;
+
+
+#endif
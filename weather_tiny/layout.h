@@ -0,0 +1,195 @@
+#ifndef _layout_h
+#define _layout_h
+
+#include "rotated_fonts.h"
+#include "view.h"
+#include "wind_arrows.h"
+
+
+// Weather screen layout, worked out at compile time from the screen size
+// and the font metrics. Slots hold the baseline, text is drawn without
+// being measured.
+// Rows stack from the header down, the forecast sits on the bottom edge
+// and the details row is centered in what is left between them. The right
+// columns stay at the right edge, the forecast columns spread over the
+// width. Values in comments are for the 250x122 panel the layout was
+// designed on, the smallest it fits.
+
+#define LAYOUT_MIN_WIDTH 250
+#define LAYOUT_MIN_HEIGHT 122
+
+static_assert(SCREEN_WIDTH >= LAYOUT_MIN_WIDTH && SCREEN_HEIGHT >= LAYOUT_MIN_HEIGHT, "screen too small for the weather layout");
+
+
+struct TextSlot {
+    int x;
+    int baseline;
+    const RotatedFont* font;
+} ;
+
+
+constexpr int EXTRA_ROWS = SCREEN_HEIGHT - LAYOUT_MIN_HEIGHT;
+
+// blank pixels between neighbouring rows and columns
+constexpr int GAP = 2;
+
+// width of chars characters of a monospace font
+constexpr int text_span(const FontMetrics& font, int chars) {
+    return font.advance * chars;
+}
+
+// Baseline of text put at y by print_text: digits and capitals start one row below y
+constexpr int text_baseline(int y, const FontMetrics& font) {
+    return y + font.cap_height + 1;
+}
+
+// y of the line-th line of text put at y, lines as close as descenders allow
+constexpr int text_line(int y, const FontMetrics& font, int line) {
+    return y + line * (font.cap_height + font.descent);
+}
+
+// y of text centered on a row of height pixels starting at top
+constexpr int text_centered(int top, int height, const FontMetrics& font) {
+    return top + (height - font.cap_height) / 2 - 1;
+}
+
+// Height of text put at y, descenders included
+constexpr int text_height(const FontMetrics& font) {
+    return font.cap_height + 1 + font.descent;
+}
+
+// Baseline of icons put at y, the tallest icon starts at y
+constexpr int icon_baseline(int y, const FontMetrics& font) {
+    return y + font.ascent;
+}
+
+constexpr int icon_height(const FontMetrics& font) {
+    return font.ascent + font.descent;
+}
+
+
+// characters of the fields, as left_pad makes them
+#define LABEL_CHARS 4  // "hour", "temp", "mm/%"
+#define DATETIME_CHARS 15  // "HH:MM Www dd/mm"
+#define TEMP_CHARS 3
+#define PRESSURE_CHARS 4
+#define WIND_CHARS 2
+#define AQ_CHARS 3
+#define FORECAST_TIME_CHARS 2
+#define FORECAST_VALUE_CHARS 4
+
+#define BATTERY_ICON_WIDTH 24
+#define BATTERY_ICON_HEIGHT 12
+#define BATTERY_PLUS_WIDTH 4
+
+
+// rows
+constexpr int HEADER_Y = 1;
+constexpr int HEADER_BASELINE = text_baseline(HEADER_Y, font_monofonto10_metrics);  // 15
+
+constexpr int CURRENT_Y = HEADER_BASELINE + font_monofonto10_metrics.descent + GAP + EXTRA_ROWS / 4;  // 22
+constexpr int CURRENT_HEIGHT = icon_height(font_meteocons10_metrics);
+
+// forecast: hour next to the icon, temperature and precipitation below it
+constexpr int FORECAST_TEMP_LINE = icon_height(font_meteocons10_metrics) + GAP;
+constexpr int FORECAST_HEIGHT = text_line(FORECAST_TEMP_LINE, font_cousine6_metrics, 1) + text_height(font_cousine6_metrics);
+constexpr int FORECAST_Y = SCREEN_HEIGHT - FORECAST_HEIGHT;  // 79
+
+// details: big numbers with three lines of small print left of them and
+// their units on the last line
+constexpr int DETAILS_HEIGHT = text_line(0, font_cousine6_metrics, 2) + text_height(font_cousine6_metrics);
+constexpr int DETAILS_SPACE = FORECAST_Y - (CURRENT_Y + CURRENT_HEIGHT);
+constexpr int DETAILS_Y = CURRENT_Y + CURRENT_HEIGHT + (DETAILS_SPACE - DETAILS_HEIGHT) / 2;  // 45
+
+// columns
+constexpr int TEMP_X = text_span(font_cousine6_metrics, LABEL_CHARS) + GAP;  // 30
+constexpr int PRESSURE_X = SCREEN_WIDTH * 2 / 5;  // 100
+constexpr int AQ_X = SCREEN_WIDTH - text_span(font_monofonto12_metrics, AQ_CHARS);  // 214
+constexpr int WIND_X = AQ_X - text_span(font_monofonto12_metrics, WIND_CHARS + 1);  // 178
+
+
+// header
+constexpr TextSlot LOCATION_SLOT = { 0, HEADER_BASELINE, &font_monofonto10 };
+constexpr TextSlot DATETIME_SLOT = {
+    SCREEN_WIDTH - text_span(font_monofonto10_metrics, DATETIME_CHARS), HEADER_BASELINE, &font_monofonto10
+};
+// left of the date, centered on its digits
+constexpr int BATTERY_X = DATETIME_SLOT.x - GAP - (BATTERY_ICON_WIDTH - 1 + BATTERY_PLUS_WIDTH);  // 71
+constexpr int BATTERY_Y = HEADER_BASELINE - (font_monofonto10_metrics.cap_height + BATTERY_ICON_HEIGHT) / 2;  // 3
+
+// current weather, the description centered on the icon
+constexpr TextSlot WEATHER_ICON_SLOT = {
+    (TEMP_X - GAP - font_meteocons10_metrics.advance) / 2, icon_baseline(CURRENT_Y, font_meteocons10_metrics), &font_meteocons10
+};
+constexpr TextSlot WEATHER_DESC_SLOT = {
+    TEMP_X, text_baseline(text_centered(CURRENT_Y, CURRENT_HEIGHT, font_cousine6_metrics), font_cousine6_metrics), &font_cousine6
+};
+
+// details, units right aligned under their values
+constexpr int DETAILS_BASELINE = text_baseline(DETAILS_Y, font_monofonto12_metrics);
+constexpr int UNITS_BASELINE = text_baseline(text_line(DETAILS_Y, font_cousine6_metrics, 2), font_cousine6_metrics);
+
+constexpr TextSlot TEMP_CURR_SLOT = { TEMP_X, text_baseline(DETAILS_Y, font_monofonto18_metrics), &font_monofonto18 };
+// degree sign after the digits, its top aligned with theirs
+constexpr TextSlot TEMP_UNIT_SLOT = {
+    TEMP_X + text_span(font_monofonto18_metrics, TEMP_CHARS),
+    icon_baseline(TEMP_CURR_SLOT.baseline - font_monofonto18_metrics.cap_height, font_meteocons8_metrics),
+    &font_meteocons8
+};
+constexpr TextSlot TEMP_HIGH_SLOT = { 0, text_baseline(DETAILS_Y, font_cousine6_metrics), &font_cousine6 };
+constexpr TextSlot TEMP_LOW_SLOT = {
+    0, text_baseline(text_line(DETAILS_Y, font_cousine6_metrics, 1), font_cousine6_metrics), &font_cousine6
+};
+constexpr TextSlot TEMP_FEEL_SLOT = { 0, UNITS_BASELINE, &font_cousine6 };
+
+constexpr int PRESSURE_RIGHT = PRESSURE_X + text_span(font_monofonto12_metrics, PRESSURE_CHARS);
+constexpr TextSlot PRESSURE_SLOT = { PRESSURE_X, DETAILS_BASELINE, &font_monofonto12 };
+constexpr TextSlot PRESSURE_UNIT_SLOT = { PRESSURE_RIGHT - text_span(font_cousine6_metrics, 3), UNITS_BASELINE, &font_cousine6 };
+
+constexpr TextSlot WIND_SLOT = { WIND_X, DETAILS_BASELINE, &font_monofonto12 };
+constexpr TextSlot WIND_UNIT_SLOT = {
+    WIND_X + text_span(font_monofonto12_metrics, WIND_CHARS) - text_span(font_cousine6_metrics, 3), UNITS_BASELINE, &font_cousine6
+};
+// arrow centered between the pressure and the last wind digit, on the
+// padding of a single digit wind (Bft hardly ever has two)
+constexpr int WIND_ARROW_X = (PRESSURE_RIGHT + WIND_X + font_monofonto12_metrics.advance) / 2;  // 169
+constexpr int WIND_ARROW_Y = DETAILS_BASELINE - font_monofonto12_metrics.cap_height / 2;
+
+constexpr TextSlot AQ_SLOT = { AQ_X, DETAILS_BASELINE, &font_monofonto12 };
+constexpr TextSlot AQ_UNIT_SLOT = { SCREEN_WIDTH - text_span(font_cousine6_metrics, 5), UNITS_BASELINE, &font_cousine6 };
+
+static_assert(PRESSURE_X >= TEMP_UNIT_SLOT.x + font_meteocons8_metrics.advance, "pressure overlaps the temperature");
+static_assert(WIND_X + font_monofonto12_metrics.advance - PRESSURE_RIGHT > 2 * wind_arrow4_radius, "wind arrow does not fit before the wind");
+
+// hourly forecast, labels share the rows of the values
+constexpr int FORECAST_TIME_BASELINE = text_baseline(
+    text_centered(FORECAST_Y, icon_height(font_meteocons10_metrics), font_cousine6_metrics), font_cousine6_metrics);
+constexpr int FORECAST_TEMP_BASELINE = text_baseline(FORECAST_Y + FORECAST_TEMP_LINE, font_cousine6_metrics);
+constexpr int FORECAST_POP_BASELINE = text_baseline(
+    text_line(FORECAST_Y + FORECAST_TEMP_LINE, font_cousine6_metrics, 1), font_cousine6_metrics);
+constexpr int FORECAST_ICON_BASELINE = icon_baseline(FORECAST_Y, font_meteocons10_metrics);
+
+constexpr TextSlot FORECAST_TIME_LABEL_SLOT = { 0, FORECAST_TIME_BASELINE, &font_cousine6 };
+constexpr TextSlot FORECAST_TEMP_LABEL_SLOT = { 0, FORECAST_TEMP_BASELINE, &font_cousine6 };
+constexpr TextSlot FORECAST_POP_LABEL_SLOT = { 0, FORECAST_POP_BASELINE, &font_cousine6 };
+
+// a column is the hour and the icon after it, values below them, columns
+// centered in equal steps right of the labels
+constexpr int FORECAST_X = text_span(font_cousine6_metrics, LABEL_CHARS + 1);  // 35
+constexpr int FORECAST_ICON_DX = text_span(font_cousine6_metrics, FORECAST_TIME_CHARS) + 2 * GAP;  // 18
+constexpr int FORECAST_COLUMN_WIDTH = FORECAST_ICON_DX + font_meteocons10_metrics.advance;  // 38
+constexpr int FORECAST_STEP = (SCREEN_WIDTH - FORECAST_X) / PERCIP_SIZE;  // 43
+
+static_assert(FORECAST_COLUMN_WIDTH >= text_span(font_cousine6_metrics, FORECAST_VALUE_CHARS), "forecast values wider than a column");
+static_assert(FORECAST_STEP >= FORECAST_COLUMN_WIDTH, "forecast does not fit the screen");
+
+constexpr int forecast_x(int column) {
+    return FORECAST_X + column * FORECAST_STEP + (FORECAST_STEP - FORECAST_COLUMN_WIDTH) / 2;
+}
+
+constexpr int forecast_icon_x(int column) {
+    return forecast_x(column) + FORECAST_ICON_DX;
+}
+
+
+#endif
@@ -0,0 +1,94 @@
+#ifndef _onecall_fields_h
+#define _onecall_fields_h
+
+#include "api_request.h"
+#include "json_extract.h"
+#include "units.h"
+#include "view.h"  // PERCIP_SIZE
+
+
+// Fields of the onecall response kept in WeatherResponse, filled by
+// weather_value_visitor while JsonPathReader walks the response.
+
+typedef WeatherResponseHourly Current;
+typedef WeatherResponseDaily Daily;
+typedef WeatherResponseRainHourly RainHourly;
+
+// onecall json paths, relative to "current"
+const JsonField<Current> current_weather_fields[] = {
+    { "dt",                    assign<Current, int, &Current::date_ts> },
+    { "sunrise",               assign<Current, int, &Current::sunr_ts> },
+    { "sunset",                assign<Current, int, &Current::suns_ts> },
+    { "temp",                  assign_converted<Current, int, &Current::temp, kelv2cels> },
+    { "feels_like",            assign_converted<Current, int, &Current::feel_t, kelv2cels> },
+    { "pressure",              assign<Current, int, &Current::pressure> },
+    { "clouds",                assign<Current, int, &Current::clouds> },
+    { "wind_speed",            assign_converted<Current, int, &Current::wind_bft, wind_ms2bft> },
+    { "wind_deg",              assign<Current, int, &Current::wind_deg> },
+    { "weather.0.icon",        assign_text<Current, ICON_SIZE, &Current::icon> },
+    { "weather.0.description", assign_text<Current, DESCR_SIZE, &Current::descr> },
+    { "snow.1h",               assign<Current, float, &Current::snow> },
+    { "rain.1h",               assign<Current, float, &Current::rain> },
+};
+
+// relative to "daily.0"
+const JsonField<Current> today_weather_fields[] = {
+    { "temp.max",              assign_converted<Current, int, &Current::max_t, kelv2cels> },
+    { "temp.min",              assign_converted<Current, int, &Current::min_t, kelv2cels> },
+};
+
+// relative to "hourly.1"
+const JsonField<Current> next_hour_weather_fields[] = {
+    { "pop",                   assign_converted<Current, int, &Current::pop, fraction2percent> },
+};
+
+// relative to "daily.<day>"
+const JsonField<Daily> forecast_weather_fields[] = {
+    { "dt",                    assign<Daily, int, &Daily::date_ts> },
+    { "temp.max",              assign_converted<Daily, int, &Daily::max_t, kelv2cels> },
+    { "temp.min",              assign_converted<Daily, int, &Daily::min_t, kelv2cels> },
+    { "wind_speed",            assign_converted<Daily, int, &Daily::wind_bft, wind_ms2bft> },
+    { "wind_deg",              assign<Daily, int, &Daily::wind_deg> },
+    { "pop",                   assign_converted<Daily, int, &Daily::pop, fraction2percent> },
+    { "snow",                  assign<Daily, float, &Daily::snow> },
+    { "rain",                  assign<Daily, float, &Daily::rain> },
+};
+
+// relative to "hourly.<hour>"
+const JsonField<RainHourly> percip_forecast_fields[] = {
+    { "dt",                    assign<RainHourly, int, &RainHourly::date_ts> },
+    { "pop",                   assign_converted<RainHourly, int, &RainHourly::pop, fraction2percent> },
+    { "snow.1h",               assign<RainHourly, float, &RainHourly::snow> },
+    { "rain.1h",               assign<RainHourly, float, &RainHourly::rain> },
+    { "feels_like",            assign_converted<RainHourly, float, &RainHourly::feel_t, kelv2cels1> },
+    { "weather.0.icon",        assign_text<RainHourly, ICON_SIZE, &RainHourly::icon> },
+};
+
+
+void weather_value_visitor(const char* path, const char* value, void* context) {
+    WeatherResponse& weather = *(WeatherResponse*) context;
+    const char* field;
+    int index;
+
+    if (strcmp(path, "timezone_offset") == 0) {
+        parse_json_value(value, weather.timezone_offset);
+    } else if ((field = json_path_under(path, "current")) != NULL) {
+        json_assign(current_weather_fields, weather.hourly[0], field, value);
+    } else if ((field = json_path_under_index(path, "daily", &index)) != NULL) {
+        if (index == 0) {
+            json_assign(today_weather_fields, weather.hourly[0], field, value);
+        } else if (index <= 2) {
+            json_assign(forecast_weather_fields, weather.daily[index-1], field, value);
+        }
+    } else if ((field = json_path_under_index(path, "hourly", &index)) != NULL) {
+        if (index == 1) {
+            json_assign(next_hour_weather_fields, weather.hourly[0], field, value);
+        }
+        if (index >= 1 && index <= PERCIP_SIZE) {
+            json_assign(percip_forecast_fields, weather.rain[index-1], field, value);
+        }
+    }
+}
+
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef _panel_h
+#define _panel_h
+
+// E-ink panels the sketch can be built for. PANEL, defined before this
+// header is included, picks the GxEPD driver and the refresh policy.
+#define PANEL_GDE0213B72B 1  // 2.13" b/w
+#define PANEL_DEPG0213BN  2  // 2.13" b/w newer panel
+
+#if PANEL == PANEL_GDE0213B72B
+#include <GxGDE0213B72B/GxGDE0213B72B.h>
+#elif PANEL == PANEL_DEPG0213BN
+#include <GxDEPG0213BN/GxDEPG0213BN.h>
+#else
+#error "PANEL has to be one of the PANEL_* values in panel.h"
+#endif
+
+
+// Refresh policy of a panel.
+// FAST_MODE is the short partial waveform of the driver, used on routine
+// wakes. It leaves ghosting behind, so every FULL_REFRESH_EVERY refreshes
+// the slow full waveform (FULL_MODE) cleans the panel.
+template<int PANEL_ID>
+struct PanelTraits;
+
+template<>
+struct PanelTraits<PANEL_GDE0213B72B> {
+    static const int BUFFER_SIZE = GxGDE0213B72B_BUFFER_SIZE;
+    static const int16_t FULL_MODE = bm_normal;
+    static const int16_t FAST_MODE = bm_partial_update;
+    static const int FULL_REFRESH_EVERY = 8;
+} ;
+
+template<>
+struct PanelTraits<PANEL_DEPG0213BN> {
+    static const int BUFFER_SIZE = GxDEPG0213BN_BUFFER_SIZE;
+    static const int16_t FULL_MODE = bm_normal;
+    static const int16_t FAST_MODE = bm_partial_update;
+    static const int FULL_REFRESH_EVERY = 8;
+} ;
+
+typedef PanelTraits<PANEL> Panel;
+
+
+#endif
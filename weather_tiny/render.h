@@ -0,0 +1,142 @@
+#ifndef _render_h
+#define _render_h
+
+#include "framebuffer.h"
+#include "rotated_fonts.h"
+#include "view.h"
+#include "layout.h"
+#include "wind_arrows.h"
+
+
+typedef FrameBuffer<SCREEN_WIDTH, SCREEN_HEIGHT> ScreenFrame;
+
+
+#define BATTERY_CHARGING 4
+
+
+// Sector of the precomputed arrow sprites nearest to deg
+int wind_arrow_sector(int deg) {
+    const int sector_deg = 360 / WIND_ARROW_SECTORS;
+    deg = (deg % 360 + 360) % 360;
+    return (deg + sector_deg / 2) / sector_deg % WIND_ARROW_SECTORS;
+}
+
+
+// Arrow centered at (x, y) pointing where the wind blows to, arrows are
+// sprites from wind_arrows.h
+void render_wind_arrow(ScreenFrame& frame, int x, int y, int deg, const RotatedFont& arrows) {
+    frame.draw_glyph(x, y, arrows, wind_arrow_sector(deg));
+}
+
+
+// number of bars on the battery icon, BATTERY_CHARGING above 100%
+int battery_icon_level(int percent) {
+    if (percent > 100) {
+        return BATTERY_CHARGING;
+    }
+    return (percent > 5) + (percent > 35) + (percent > 70);
+}
+
+
+// Battery outline, static part of the icon drawn by render_chrome
+void render_battery_outline(ScreenFrame& frame, int x, int y) {
+    frame.draw_rect(x, y, BATTERY_ICON_WIDTH, BATTERY_ICON_HEIGHT);
+
+    // the small battery plus-side rectangle
+    frame.fill_round_rect(x+BATTERY_ICON_WIDTH-1, y+3, BATTERY_PLUS_WIDTH, BATTERY_ICON_HEIGHT-2*3, 2);
+}
+
+
+// Bars or the charging sign inside the battery outline
+void render_battery_level(ScreenFrame& frame, int x, int y, int percent) {
+    const int bar_width = 6;
+    const int bar_height = 8;
+    const int bar_margin = 2;
+
+    int level = battery_icon_level(percent);
+
+    // draw charging icon
+    if (level == BATTERY_CHARGING) {
+        const int margin = 2;
+        const int half_w = BATTERY_ICON_WIDTH / 2;
+        const int half_h = BATTERY_ICON_HEIGHT / 2;
+
+        frame.fill_triangle(x-margin+half_w, y+half_h, x-margin+half_w, y+half_h/2, x+half_w+half_w/2, y+half_h);
+        frame.fill_triangle(x+margin+half_w, y+half_h, x+margin+half_w, y+half_h+half_h/2, x+half_w-half_w/2, y+half_h);
+        return;
+    }
+
+    // 3-level percent bar
+    for (int bar = 0; bar < level; bar++) {
+        frame.fill_rect(x+bar_margin+bar*(bar_width+1), y+bar_margin, bar_width, bar_height);
+    }
+}
+
+
+void render_text(ScreenFrame& frame, const TextSlot& slot, const char* text) {
+    frame.draw_text(slot.x, slot.baseline, *slot.font, text);
+}
+
+
+void render_text(ScreenFrame& frame, const TextSlot& slot, const String& text) {
+    render_text(frame, slot, text.c_str());
+}
+
+
+// Everything on the weather screen that does not depend on the view: unit
+// labels and the battery outline. Rasterized at build time by
+// tools/chromegen.cpp into chrome_bitmap.h, on the device the frame starts
+// as a copy of that bitmap and only the view fields are drawn over it.
+void render_chrome(ScreenFrame& frame) {
+    render_text(frame, TEMP_UNIT_SLOT, "*");  // celsius
+    render_text(frame, PRESSURE_UNIT_SLOT, "hPa");
+    render_text(frame, WIND_UNIT_SLOT, "Bft");
+    render_text(frame, AQ_UNIT_SLOT, "PM2.5");
+
+    render_text(frame, FORECAST_TIME_LABEL_SLOT, "hour");
+    render_text(frame, FORECAST_TEMP_LABEL_SLOT, "temp");
+    render_text(frame, FORECAST_POP_LABEL_SLOT, "mm/%");
+
+    render_battery_outline(frame, BATTERY_X, BATTERY_Y);
+}
+
+
+void render_header(ScreenFrame& frame, View& view) {
+    render_text(frame, LOCATION_SLOT, view.location);
+    render_text(frame, DATETIME_SLOT, view.datetime);
+    render_battery_level(frame, BATTERY_X, BATTERY_Y, view.battery_percent);
+}
+
+
+void render_weather(ScreenFrame& frame, View& view) {
+    render_text(frame, WEATHER_ICON_SLOT, view.weather_icon);
+    render_text(frame, WEATHER_DESC_SLOT, view.weather_desc);
+    render_text(frame, TEMP_CURR_SLOT, view.temp_curr);
+
+    render_text(frame, TEMP_HIGH_SLOT, view.temp_high);
+    render_text(frame, TEMP_LOW_SLOT, view.temp_low);
+    render_text(frame, TEMP_FEEL_SLOT, view.temp_feel);
+
+    render_text(frame, PRESSURE_SLOT, view.pressure);
+
+    // wind
+    render_text(frame, WIND_SLOT, view.wind);
+    render_wind_arrow(frame, WIND_ARROW_X, WIND_ARROW_Y, view.wind_deg, wind_arrow4);
+
+    // hourly rain forecast
+    for (int i = 0; i < PERCIP_SIZE; i++) {
+        const RotatedFont& font = font_cousine6;
+        frame.draw_text(forecast_x(i), FORECAST_TIME_BASELINE, font, view.percip_time[i].c_str());
+        frame.draw_text(forecast_x(i), FORECAST_TEMP_BASELINE, font, view.percip[i].c_str());
+        frame.draw_text(forecast_x(i), FORECAST_POP_BASELINE, font, view.percic_pop[i].c_str());
+        frame.draw_text(forecast_icon_x(i), FORECAST_ICON_BASELINE, font_meteocons10, view.percip_icon[i].c_str());
+    }
+}
+
+
+void render_air_quality(ScreenFrame& frame, View& view) {
+    render_text(frame, AQ_SLOT, view.aq_pm25);
+}
+
+
+#endif
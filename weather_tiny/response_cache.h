@@ -0,0 +1,111 @@
+#ifndef _response_cache_h
+#define _response_cache_h
+
+#include <time.h>
+#include "api_request.h"
+#include "datetime.h"
+
+
+// Last good response of each location, kept in RTC memory through deep sleep
+template<typename T>
+struct CachedResponse {
+    time_t fetched_ts;  // 0 when empty
+    T response;
+} ;
+
+
+struct ResponseCache {
+    CachedResponse<WeatherResponse> weather[MAX_LOCATION_CNT];
+    time_t daily_fetched_ts[MAX_LOCATION_CNT];  // daily block of the weather entry, 0 when empty
+    CachedResponse<AirQualityResponse> air_quality[MAX_LOCATION_CNT];
+} ;
+
+RTC_DATA_ATTR struct ResponseCache response_cache;
+
+
+template<typename T>
+void cache_store(CachedResponse<T>& entry, const T& response) {
+    entry.response = response;
+    entry.fetched_ts = time(NULL);
+}
+
+
+// When the device went to deep sleep, set by cache_note_sleep_start. 0 before the first sleep.
+RTC_DATA_ATTR time_t sleep_started_ts;
+
+
+void cache_note_sleep_start() {
+    sleep_started_ts = is_clock_set() ? time(NULL) : 0;
+}
+
+
+// Half of the sleep that ended with this wake. The interval changes from wake
+// to wake (night, low battery, weather ahead), so it is measured rather than
+// taken from the config. SLEEP_INTERVAL_MIN stands in while it is unknown.
+int timer_wake_slack_sec() {
+    time_t now = time(NULL);
+    if (sleep_started_ts == 0 || !is_clock_set() || now <= sleep_started_ts) {
+        return SLEEP_INTERVAL_MIN * 30;
+    }
+    return (now - sleep_started_ts) / 2;
+}
+
+
+// Timer wakes drift by some seconds, with slack_sec timer_wake_slack_sec() an
+// entry counts as fresh while the next wake would find it past its ttl by
+// more than half the sleep interval. Button wakes are off the schedule and
+// pass 0, the entry is fresh for its whole ttl.
+template<typename T>
+bool cache_is_fresh(const CachedResponse<T>& entry, const int ttl_min, const int slack_sec = timer_wake_slack_sec()) {
+    if (entry.fetched_ts == 0 || !is_clock_set()) {
+        return false;
+    }
+    return time(NULL) - entry.fetched_ts + slack_sec < ttl_min * 60;
+}
+
+
+// The daily block of the cached weather is still good for the next response
+// while younger than DAILY_TTL_MIN and from the same local day: after midnight
+// the forecast days move on.
+bool cache_daily_is_fresh(const int loc, const int slack_sec = timer_wake_slack_sec()) {
+    const CachedResponse<WeatherResponse>& entry = response_cache.weather[loc];
+    time_t daily_ts = response_cache.daily_fetched_ts[loc];
+
+    if (entry.fetched_ts == 0 || daily_ts == 0 || !is_clock_set()) {
+        return false;
+    }
+    int offset = entry.response.timezone_offset;
+    if (local_datetime(offset).dt / (24 * 3600) != (daily_ts + offset) / (24 * 3600)) {
+        return false;
+    }
+    return time(NULL) - daily_ts + slack_sec < DAILY_TTL_MIN * 60;
+}
+
+
+// response fetched without the daily block takes it from the cached one
+void cache_merge_daily(const int loc, WeatherResponse& weather) {
+    const WeatherResponse& cached = response_cache.weather[loc].response;
+    weather.hourly[0].max_t = cached.hourly[0].max_t;
+    weather.hourly[0].min_t = cached.hourly[0].min_t;
+    memcpy(weather.daily, cached.daily, sizeof(weather.daily));
+}
+
+
+// fails for empty entries and ones older than max_age_min
+template<typename T>
+bool cache_load(const CachedResponse<T>& entry, T& response, const int max_age_min) {
+    if (entry.fetched_ts == 0 || time(NULL) - entry.fetched_ts > max_age_min * 60) {
+        return false;
+    }
+    response = entry.response;
+    Serial.printf("Using cached response from %ld minutes ago\n", (long) (time(NULL) - entry.fetched_ts) / 60);
+    return true;
+}
+
+
+void clear_response_cache() {
+    memset(&response_cache, 0, sizeof(response_cache));
+}
+
+
+#endif
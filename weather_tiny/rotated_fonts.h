@@ -0,0 +1,661 @@
+// Generated by tools/fontgen.py, do not edit.
+#ifndef _rotated_fonts_h
+#define _rotated_fonts_h
+
+#include "framebuffer.h"
+
+
+// font_monofonto10 from Monofonto10pt.h, 95 of 95 glyphs
+const uint8_t font_monofonto10_bitmap[] PROGMEM = {
+  0x00, 0xFF, 0x9C, 0xFF, 0x9C, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x40, 0x04,
+  0xCC, 0x0D, 0xFC, 0x1F, 0xC0, 0xFC, 0xC4, 0x8C, 0xFC, 0x0F, 0xF0, 0xFE,
+  0xC0, 0xEC, 0x80, 0x08, 0x00, 0x0F, 0x06, 0x00, 0x1F, 0x87, 0x00, 0x3B,
+  0xC7, 0x00, 0xF1, 0xC3, 0xC0, 0xF0, 0xE3, 0xC0, 0x38, 0xE3, 0x00, 0x3C,
+  0x7F, 0x00, 0x1C, 0x7E, 0x00, 0xFE, 0x04, 0x82, 0x0C, 0x82, 0x30, 0xFE,
+  0xE0, 0x01, 0x80, 0x06, 0x00, 0x1F, 0xFC, 0x32, 0x04, 0xC2, 0x04, 0x83,
+  0xFC, 0x00, 0x70, 0x01, 0xF8, 0x7F, 0x9C, 0xFF, 0x0C, 0xC7, 0x8C, 0xFD,
+  0xFC, 0x78, 0xF8, 0x00, 0xFC, 0x01, 0xCC, 0x00, 0x84, 0xF8, 0xF8, 0x01,
+  0xF0, 0x00, 0x1F, 0xFF, 0x80, 0x7E, 0x07, 0xE0, 0xE0, 0x00, 0x70, 0x80,
+  0x00, 0x20, 0xE0, 0x00, 0x70, 0x7E, 0x07, 0xE0, 0x1F, 0xFF, 0x80, 0x01,
+  0xF0, 0x00, 0x30, 0x00, 0x18, 0x80, 0x19, 0x80, 0x0B, 0x80, 0xFE, 0x00,
+  0xFC, 0x00, 0x0B, 0x00, 0x19, 0x80, 0x19, 0x00, 0x30, 0x00, 0x0C, 0x00,
+  0x0C, 0x00, 0x0C, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x0C, 0x00, 0x0C, 0x00,
+  0x0C, 0x00, 0x04, 0xFC, 0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0,
+  0xE0, 0x00, 0x00, 0x20, 0x00, 0x00, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x1E,
+  0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00,
+  0x00, 0xE0, 0x00, 0x00, 0x80, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xF8, 0xFF,
+  0xFC, 0xC0, 0x0C, 0xC0, 0x0C, 0xFF, 0xFC, 0x7F, 0xF8, 0x3F, 0xF0, 0x38,
+  0x00, 0x70, 0x00, 0x7F, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x30, 0x04, 0x70,
+  0x0C, 0xF0, 0x3C, 0xC0, 0xFC, 0xC3, 0xEC, 0xEF, 0xCC, 0x7F, 0x0C, 0x3C,
+  0x0C, 0x30, 0x30, 0x70, 0x38, 0xE0, 0x1C, 0xC0, 0x0C, 0xC3, 0x0C, 0xE7,
+  0x1C, 0x7F, 0xF8, 0x3C, 0xF0, 0x01, 0xE0, 0x07, 0x60, 0x1C, 0x60, 0xF0,
+  0x60, 0xC0, 0x60, 0xFF, 0xFC, 0xFF, 0xFC, 0x00, 0x60, 0xFF, 0x18, 0xFF,
+  0x38, 0xC7, 0x1C, 0xC6, 0x0C, 0xC6, 0x0C, 0xC7, 0x1C, 0xC7, 0xF8, 0xC3,
+  0xF0, 0x01, 0xF0, 0x07, 0xF8, 0x1F, 0x1C, 0x7E, 0x0C, 0xF6, 0x0C, 0xC7,
+  0x1C, 0x83, 0xF8, 0x01, 0xF0, 0xC0, 0x04, 0xC0, 0x1C, 0xC0, 0x7C, 0xC3,
+  0xFC, 0xCF, 0xE0, 0xFF, 0x00, 0xFC, 0x00, 0xE0, 0x00, 0x39, 0xF0, 0x7F,
+  0xF8, 0xEF, 0x1C, 0xC6, 0x0C, 0xC6, 0x0C, 0xEF, 0x1C, 0x7F, 0xF8, 0x39,
+  0xF0, 0x3E, 0x00, 0x7F, 0x04, 0xE7, 0x1C, 0xC3, 0x3C, 0xC3, 0xF8, 0xE7,
+  0xE0, 0x7F, 0x80, 0x3E, 0x00, 0xE1, 0xC0, 0xE1, 0xC0, 0x00, 0x30, 0xE1,
+  0xF0, 0xE1, 0xC0, 0x0C, 0x00, 0x1E, 0x00, 0x12, 0x00, 0x33, 0x00, 0x21,
+  0x00, 0x61, 0x80, 0x41, 0x80, 0xC0, 0xC0, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+  0xCC, 0xCC, 0xCC, 0xC0, 0xC0, 0x41, 0x80, 0x61, 0x80, 0x21, 0x00, 0x33,
+  0x00, 0x12, 0x00, 0x1E, 0x00, 0x0C, 0x00, 0x10, 0x00, 0x70, 0x00, 0xF0,
+  0x88, 0xC3, 0x9C, 0xC7, 0x9C, 0xFE, 0x00, 0x7C, 0x00, 0x18, 0x00, 0x07,
+  0xC0, 0x3F, 0xF0, 0x60, 0x18, 0xC3, 0x8C, 0x84, 0xC4, 0x84, 0x40, 0x87,
+  0x80, 0xC0, 0x40, 0x60, 0xC0, 0x1F, 0x80, 0x00, 0x3C, 0x07, 0xFC, 0x7F,
+  0xF8, 0xFF, 0x30, 0xFF, 0xB0, 0x7F, 0xFC, 0x03, 0xFC, 0x00, 0x3C, 0xFF,
+  0xFC, 0xFF, 0xFC, 0xC3, 0x0C, 0xC3, 0x0C, 0xC3, 0x0C, 0xFF, 0xFC, 0x7D,
+  0xF8, 0x38, 0xF0, 0x3F, 0xF0, 0x7F, 0xF8, 0xE0, 0x3C, 0xC0, 0x0C, 0xC0,
+  0x0C, 0xF0, 0x3C, 0x70, 0x38, 0x30, 0x30, 0xFF, 0xFC, 0xFF, 0xFC, 0xC0,
+  0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xF0, 0x1C, 0x7F, 0xF8, 0x3F, 0xF0, 0xFF,
+  0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xC3, 0x0C, 0xC3, 0x0C, 0xC3, 0x0C, 0xC3,
+  0x0C, 0xC0, 0x0C, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xC3, 0x00, 0xC3,
+  0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC0, 0x00, 0x3F, 0xF0, 0x7F, 0xF8, 0xF0,
+  0x1C, 0xC0, 0x0C, 0xC3, 0x0C, 0xF3, 0x18, 0x73, 0xFC, 0x33, 0xFC, 0xFF,
+  0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x03, 0x00, 0x03, 0x00, 0xFF, 0xFC, 0xFF,
+  0xFC, 0xFF, 0xFC, 0xC0, 0x0C, 0xC0, 0x0C, 0xFF, 0xFC, 0xFF, 0xFC, 0xC0,
+  0x0C, 0xC0, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0xC0,
+  0x1C, 0xFF, 0xFC, 0xFF, 0xF8, 0xFF, 0xE0, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF,
+  0xFC, 0x07, 0x80, 0x1F, 0xE0, 0xF8, 0xFC, 0xE0, 0x3C, 0x80, 0x0C, 0xFF,
+  0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00,
+  0x0C, 0x00, 0x0C, 0xFF, 0xFC, 0xFF, 0xFC, 0xFE, 0x00, 0x0F, 0xC0, 0x0F,
+  0xF0, 0x7E, 0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFC,
+  0x00, 0x3F, 0x80, 0x07, 0xE0, 0x01, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x3F,
+  0xF0, 0x7F, 0xF8, 0xE0, 0x1C, 0xC0, 0x0C, 0xC0, 0x0C, 0xE0, 0x1C, 0x7F,
+  0xF8, 0x3F, 0xF0, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xC1, 0x80, 0xC1,
+  0x80, 0xE3, 0x80, 0x7F, 0x00, 0x7F, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xF8,
+  0x00, 0xE0, 0x1C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0E, 0x00, 0xE0, 0x1F,
+  0x80, 0x7F, 0xFB, 0x80, 0x3F, 0xF0, 0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF,
+  0xFC, 0xC1, 0xC0, 0xC1, 0xF0, 0xF7, 0xFC, 0x7F, 0x3C, 0x3E, 0x0C, 0x00,
+  0x04, 0x3C, 0x30, 0x7E, 0x38, 0xEE, 0x1C, 0xC7, 0x1C, 0xC3, 0x0C, 0xE3,
+  0x9C, 0x71, 0xF8, 0x31, 0xF8, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFF,
+  0xFC, 0xFF, 0xFC, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xF8, 0xFF,
+  0xF8, 0x00, 0x1C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x1C, 0xFF, 0xF8, 0xFF,
+  0xF8, 0x80, 0x00, 0xF8, 0x00, 0xFF, 0x80, 0x3F, 0xF8, 0x01, 0xFC, 0x01,
+  0xFC, 0x1F, 0xF8, 0xFF, 0x80, 0xF8, 0x00, 0x80, 0x00, 0xC0, 0x00, 0xFF,
+  0xC0, 0xFF, 0xFC, 0x00, 0xFC, 0x0F, 0xE0, 0x1F, 0xE0, 0x00, 0xFC, 0xFF,
+  0xFC, 0xFF, 0xC0, 0xC0, 0x00, 0xC0, 0x0C, 0xF8, 0x7C, 0xFF, 0xFC, 0x1F,
+  0xE0, 0x1F, 0xE0, 0xFF, 0xFC, 0xF8, 0x7C, 0xC0, 0x0C, 0x80, 0x00, 0xE0,
+  0x00, 0xFC, 0x00, 0x7F, 0x00, 0x0F, 0xFC, 0x0F, 0xFC, 0x7F, 0x00, 0xFC,
+  0x00, 0xE0, 0x00, 0x80, 0x00, 0x00, 0x04, 0xC0, 0x0C, 0xC0, 0x7C, 0xC1,
+  0xFC, 0xC7, 0xEC, 0xDF, 0x8C, 0xFE, 0x0C, 0xF0, 0x0C, 0xC0, 0x0C, 0xFF,
+  0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xC0, 0x00, 0x30, 0xC0, 0x00, 0x30, 0x80,
+  0x00, 0x00, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03,
+  0xC0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0xC0, 0x00,
+  0x00, 0xE0, 0x00, 0x00, 0x20, 0xC0, 0x00, 0x30, 0xC0, 0x00, 0x30, 0xFF,
+  0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x06, 0x1E, 0x78, 0xE0, 0xE0, 0x78, 0x1E,
+  0x06, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80,
+  0xC0, 0xF0, 0x30, 0x27, 0x80, 0x6F, 0xC0, 0xEF, 0xC0, 0xCC, 0xC0, 0xCC,
+  0xC0, 0xED, 0x80, 0xFF, 0xC0, 0x7F, 0xC0, 0xFF, 0xFC, 0xFF, 0xFC, 0x03,
+  0x30, 0x04, 0x08, 0x0C, 0x0C, 0x0E, 0x1C, 0x0F, 0xFC, 0x07, 0xF8, 0x3F,
+  0x00, 0x7F, 0x80, 0x61, 0xC0, 0xE1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE1,
+  0xC0, 0x40, 0x80, 0x07, 0xF8, 0x0F, 0xFC, 0x0E, 0x1C, 0x0C, 0x0C, 0x04,
+  0x08, 0x03, 0x30, 0xFF, 0xFC, 0xFF, 0xFC, 0x3F, 0x00, 0x7F, 0x80, 0xE9,
+  0xC0, 0xC8, 0xC0, 0xC8, 0xC0, 0xE9, 0xC0, 0x79, 0x80, 0x39, 0x00, 0x0C,
+  0x00, 0x0C, 0x00, 0x7F, 0xFC, 0xFF, 0xFC, 0xEC, 0x00, 0xCC, 0x00, 0xCC,
+  0x00, 0xC0, 0x00, 0x3F, 0x18, 0x7F, 0x9C, 0xE1, 0xCC, 0xC0, 0xCC, 0xC0,
+  0xCC, 0x33, 0x1C, 0xFF, 0xF8, 0xFF, 0xF0, 0xFF, 0xFC, 0xFF, 0xFC, 0x03,
+  0x00, 0x04, 0x00, 0x0C, 0x00, 0x0E, 0x00, 0x0F, 0xFC, 0x07, 0xFC, 0x0C,
+  0x0C, 0x0C, 0x0C, 0xEF, 0xFC, 0xEF, 0xFC, 0x00, 0x0C, 0x00, 0x0C, 0x0C,
+  0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0xEF, 0xFF, 0xC0, 0xEF,
+  0xFF, 0x80, 0x4F, 0xFE, 0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0x00, 0x80, 0x01,
+  0xE0, 0x07, 0xF8, 0x0E, 0x3C, 0x0C, 0x1C, 0x08, 0x04, 0xC0, 0x00, 0xC0,
+  0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xC0, 0xFF, 0xC0, 0xC0,
+  0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0xC0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF,
+  0xC0, 0xFF, 0xC0, 0x30, 0x00, 0x40, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0xFF,
+  0xC0, 0x7F, 0xC0, 0x3F, 0x00, 0x7F, 0x80, 0xE1, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xE1, 0xC0, 0x7F, 0x80, 0x3F, 0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0x61,
+  0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xF3, 0xC0, 0xFF, 0xC0, 0x3F, 0x00, 0x7F,
+  0x80, 0xFF, 0xC0, 0xE1, 0xC0, 0xC0, 0xC0, 0x40, 0x80, 0x33, 0x00, 0xFF,
+  0xFC, 0xFF, 0xFC, 0xFF, 0xC0, 0xFF, 0xC0, 0x3F, 0xC0, 0x40, 0x00, 0xC0,
+  0x00, 0xE0, 0x00, 0xE0, 0x00, 0x40, 0x00, 0x31, 0x00, 0x79, 0x80, 0xF9,
+  0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xE7, 0xC0, 0x67, 0x80, 0x03, 0x00, 0x18,
+  0x00, 0x18, 0x00, 0xFF, 0xF0, 0xFF, 0xF8, 0x18, 0x38, 0x18, 0x18, 0x18,
+  0x18, 0x00, 0x18, 0xFF, 0x00, 0xFF, 0x80, 0x01, 0xC0, 0x00, 0xC0, 0x00,
+  0xC0, 0x01, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0x80, 0x00, 0xE0, 0x00, 0xFC,
+  0x00, 0x7F, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x3F, 0xC0, 0xFC, 0x00, 0xE0,
+  0x00, 0x80, 0x00, 0x80, 0x00, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xC0, 0x1F,
+  0x00, 0xFF, 0x00, 0x0F, 0xC0, 0xFF, 0xC0, 0xFC, 0x00, 0x80, 0x00, 0x80,
+  0x40, 0xE1, 0xC0, 0xFF, 0xC0, 0x3F, 0x00, 0x3F, 0x00, 0xFF, 0xC0, 0xE1,
+  0xC0, 0x80, 0x40, 0x80, 0x00, 0xE0, 0x00, 0xFC, 0x00, 0x7F, 0xCC, 0x07,
+  0xFC, 0x03, 0xF8, 0x3F, 0xC0, 0xFE, 0x00, 0xE0, 0x00, 0x80, 0x00, 0xC0,
+  0x40, 0xC1, 0xC0, 0xC7, 0xC0, 0xCF, 0xC0, 0xFC, 0xC0, 0xF8, 0xC0, 0xE0,
+  0xC0, 0x80, 0xC0, 0x00, 0x60, 0x00, 0x71, 0xF1, 0xC0, 0xFF, 0xBF, 0xF0,
+  0xE0, 0x00, 0x70, 0xC0, 0x00, 0x30, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0,
+  0xC0, 0x00, 0x30, 0xE0, 0x00, 0x70, 0xFF, 0xBF, 0xF0, 0x71, 0xF1, 0xC0,
+  0x00, 0x60, 0x00, 0x60, 0xC0, 0xC0, 0xC0, 0x40, 0x60, 0x60, 0x60, 0x60,
+  0xC0,
+};
+
+const RotatedGlyph font_monofonto10_glyphs[] PROGMEM = {
+  {     0,   1,   1,  10,   0,    0 },  // 0x20 ' '
+  {     1,   2,  14,  10,   4,  -13 },  // 0x21 '!'
+  {     5,   4,   5,  10,   3,  -13 },  // 0x22 '"'
+  {     9,  10,  14,  10,   0,  -13 },  // 0x23 '#'
+  {    29,   8,  18,  10,   1,  -15 },  // 0x24 '$'
+  {    53,  10,  14,  10,   0,  -13 },  // 0x25 '%'
+  {    73,  10,  14,  10,   0,  -13 },  // 0x26 '&'
+  {    93,   2,   5,  10,   4,  -13 },  // 0x27 "'"
+  {    95,   5,  20,  10,   4,  -15 },  // 0x28 '('
+  {   110,   4,  20,  10,   2,  -15 },  // 0x29 ')'
+  {   122,  10,   9,  10,   0,  -13 },  // 0x2A '*'
+  {   142,   8,   9,  10,   1,  -11 },  // 0x2B '+'
+  {   158,   3,   6,  10,   3,   -2 },  // 0x2C ','
+  {   161,   6,   2,  10,   2,   -7 },  // 0x2D '-'
+  {   167,   2,   3,  10,   4,   -2 },  // 0x2E '.'
+  {   169,  10,  19,  10,   0,  -15 },  // 0x2F '/'
+  {   199,   8,  14,  10,   1,  -13 },  // 0x30 '0'
+  {   215,   5,  14,  10,   2,  -13 },  // 0x31 '1'
+  {   225,   8,  14,  10,   1,  -13 },  // 0x32 '2'
+  {   241,   8,  14,  10,   1,  -13 },  // 0x33 '3'
+  {   257,   8,  14,  10,   1,  -13 },  // 0x34 '4'
+  {   273,   8,  14,  10,   1,  -13 },  // 0x35 '5'
+  {   289,   8,  14,  10,   1,  -13 },  // 0x36 '6'
+  {   305,   8,  14,  10,   1,  -13 },  // 0x37 '7'
+  {   321,   8,  14,  10,   1,  -13 },  // 0x38 '8'
+  {   337,   8,  14,  10,   1,  -13 },  // 0x39 '9'
+  {   353,   2,  10,  10,   4,   -9 },  // 0x3A ':'
+  {   357,   3,  12,  10,   3,   -9 },  // 0x3B ';'
+  {   363,   8,  10,  10,   1,  -11 },  // 0x3C '<'
+  {   379,   8,   6,  10,   1,   -9 },  // 0x3D '='
+  {   387,   8,  10,  10,   1,  -11 },  // 0x3E '>'
+  {   403,   8,  14,  10,   1,  -13 },  // 0x3F '?'
+  {   419,  10,  14,  10,   0,  -11 },  // 0x40 '@'
+  {   439,   8,  14,  10,   1,  -13 },  // 0x41 'A'
+  {   455,   8,  14,  10,   1,  -13 },  // 0x42 'B'
+  {   471,   8,  14,  10,   1,  -13 },  // 0x43 'C'
+  {   487,   8,  14,  10,   1,  -13 },  // 0x44 'D'
+  {   503,   8,  14,  10,   1,  -13 },  // 0x45 'E'
+  {   519,   8,  14,  10,   1,  -13 },  // 0x46 'F'
+  {   535,   8,  14,  10,   1,  -13 },  // 0x47 'G'
+  {   551,   8,  14,  10,   1,  -13 },  // 0x48 'H'
+  {   567,   6,  14,  10,   2,  -13 },  // 0x49 'I'
+  {   579,   8,  14,  10,   1,  -13 },  // 0x4A 'J'
+  {   595,   8,  14,  10,   1,  -13 },  // 0x4B 'K'
+  {   611,   8,  14,  10,   1,  -13 },  // 0x4C 'L'
+  {   627,   8,  14,  10,   1,  -13 },  // 0x4D 'M'
+  {   643,   8,  14,  10,   1,  -13 },  // 0x4E 'N'
+  {   659,   8,  14,  10,   1,  -13 },  // 0x4F 'O'
+  {   675,   8,  14,  10,   1,  -13 },  // 0x50 'P'
+  {   691,   8,  17,  10,   1,  -13 },  // 0x51 'Q'
+  {   715,   9,  14,  10,   1,  -13 },  // 0x52 'R'
+  {   733,   8,  14,  10,   1,  -13 },  // 0x53 'S'
+  {   749,   8,  14,  10,   1,  -13 },  // 0x54 'T'
+  {   765,   8,  14,  10,   1,  -13 },  // 0x55 'U'
+  {   781,  10,  14,  10,   0,  -13 },  // 0x56 'V'
+  {   801,  10,  14,  10,   0,  -13 },  // 0x57 'W'
+  {   821,   8,  14,  10,   1,  -13 },  // 0x58 'X'
+  {   837,  10,  14,  10,   0,  -13 },  // 0x59 'Y'
+  {   857,   9,  14,  10,   0,  -13 },  // 0x5A 'Z'
+  {   875,   4,  20,  10,   5,  -15 },  // 0x5B '['
+  {   887,  10,  19,  10,   0,  -15 },  // 0x5C '\\'
+  {   917,   4,  20,  10,   1,  -15 },  // 0x5D ']'
+  {   929,   8,   7,  10,   1,  -13 },  // 0x5E '^'
+  {   937,  10,   2,  10,   0,    3 },  // 0x5F '_'
+  {   947,   4,   4,  10,   3,  -13 },  // 0x60 '`'
+  {   951,   8,  10,  10,   1,   -9 },  // 0x61 'a'
+  {   967,   8,  14,  10,   1,  -13 },  // 0x62 'b'
+  {   983,   8,  10,  10,   1,   -9 },  // 0x63 'c'
+  {   999,   8,  14,  10,   1,  -13 },  // 0x64 'd'
+  {  1015,   8,  10,  10,   1,   -9 },  // 0x65 'e'
+  {  1031,   8,  14,  10,   1,  -13 },  // 0x66 'f'
+  {  1047,   8,  14,  10,   1,   -9 },  // 0x67 'g'
+  {  1063,   8,  14,  10,   1,  -13 },  // 0x68 'h'
+  {  1079,   6,  14,  10,   2,  -13 },  // 0x69 'i'
+  {  1091,   6,  18,  10,   2,  -13 },  // 0x6A 'j'
+  {  1109,   8,  14,  10,   1,  -13 },  // 0x6B 'k'
+  {  1125,   5,  14,  10,   2,  -13 },  // 0x6C 'l'
+  {  1135,   8,  10,  10,   1,   -9 },  // 0x6D 'm'
+  {  1151,   8,  10,  10,   1,   -9 },  // 0x6E 'n'
+  {  1167,   8,  10,  10,   1,   -9 },  // 0x6F 'o'
+  {  1183,   8,  14,  10,   1,   -9 },  // 0x70 'p'
+  {  1199,   8,  14,  10,   1,   -9 },  // 0x71 'q'
+  {  1215,   8,  10,  10,   1,   -9 },  // 0x72 'r'
+  {  1231,   8,  10,  10,   1,   -9 },  // 0x73 's'
+  {  1247,   8,  13,  10,   1,  -12 },  // 0x74 't'
+  {  1263,   8,  10,  10,   1,   -9 },  // 0x75 'u'
+  {  1279,  10,  10,  10,   0,   -9 },  // 0x76 'v'
+  {  1299,  10,  10,  10,   0,   -9 },  // 0x77 'w'
+  {  1319,   8,  10,  10,   1,   -9 },  // 0x78 'x'
+  {  1335,  10,  14,  10,   0,   -9 },  // 0x79 'y'
+  {  1355,   8,  10,  10,   1,   -9 },  // 0x7A 'z'
+  {  1371,   5,  20,  10,   4,  -15 },  // 0x7B '{'
+  {  1386,   2,  19,  10,   4,  -15 },  // 0x7C '|'
+  {  1392,   5,  20,  10,   1,  -15 },  // 0x7D '}'
+  {  1407,  10,   3,  10,   0,   -8 },  // 0x7E '~'
+};
+
+const RotatedFont font_monofonto10 PROGMEM = { font_monofonto10_bitmap, font_monofonto10_glyphs, 0x20, 0x7E, 24 };
+
+// advance, cap height, ascent, descent, line height
+constexpr FontMetrics font_monofonto10_metrics = { 10, 13, 15, 5, 24 };
+
+
+// font_monofonto12 from Monofonto12pt.h, 12 of 95 glyphs
+const uint8_t font_monofonto12_bitmap[] PROGMEM = {
+  0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x1F, 0xFC, 0x00,
+  0x7F, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80,
+  0xE0, 0x03, 0x80, 0xF0, 0x07, 0x80, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0x00,
+  0x1F, 0xFC, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00,
+  0x7F, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x08, 0x00, 0x80,
+  0x78, 0x01, 0x80, 0x78, 0x07, 0x80, 0xF0, 0x0F, 0x80, 0xE0, 0x3F, 0x80,
+  0xE0, 0xFF, 0x80, 0xE3, 0xF3, 0x80, 0x7F, 0xC3, 0x80, 0x7F, 0x83, 0x80,
+  0x1E, 0x03, 0x80, 0x08, 0x0C, 0x00, 0x70, 0x0F, 0x00, 0x70, 0x0F, 0x00,
+  0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE1, 0x83, 0x80, 0xE1, 0xC3, 0x80,
+  0x7F, 0xFF, 0x00, 0x7F, 0x7F, 0x00, 0x1C, 0x3E, 0x00, 0x00, 0x78, 0x00,
+  0x03, 0xF8, 0x00, 0x0F, 0xB8, 0x00, 0x3E, 0x38, 0x00, 0xF8, 0x38, 0x00,
+  0xE0, 0x38, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x00, 0x38, 0x00,
+  0x00, 0x38, 0x00, 0x00, 0x02, 0x00, 0xFF, 0xC7, 0x00, 0xFF, 0xCF, 0x80,
+  0xE3, 0x83, 0x80, 0xE3, 0x83, 0x80, 0xE3, 0x83, 0x80, 0xE3, 0x87, 0x80,
+  0xE3, 0xFF, 0x00, 0xE1, 0xFE, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00,
+  0x01, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x1F, 0xC3, 0x80, 0x7F, 0x83, 0x80,
+  0xFB, 0x83, 0x80, 0xE1, 0xC3, 0x80, 0xC1, 0xFF, 0x00, 0x81, 0xFF, 0x00,
+  0x00, 0x7C, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x01, 0x80, 0xE0, 0x07, 0x80,
+  0xE0, 0x3F, 0x80, 0xE1, 0xFF, 0x80, 0xE7, 0xFC, 0x00, 0xFF, 0xE0, 0x00,
+  0xFF, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x00,
+  0x7E, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0xE3, 0xC3, 0x80, 0xE3, 0x83, 0x80,
+  0xE3, 0x83, 0x80, 0xE3, 0xC3, 0x80, 0x7F, 0xFF, 0x80, 0x7E, 0xFF, 0x00,
+  0x00, 0x7E, 0x00, 0x1F, 0x00, 0x00, 0x7F, 0x80, 0x80, 0x7F, 0xC1, 0x80,
+  0xE1, 0xC7, 0x80, 0xE1, 0xCF, 0x80, 0xE1, 0xFF, 0x00, 0xE1, 0xFC, 0x00,
+  0x7F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0x00, 0x00,
+};
+
+const RotatedGlyph font_monofonto12_glyphs[] PROGMEM = {
+  {     0,   1,   1,  12,   0,    0 },  // 0x20 ' '
+  {     0,   0,   0,  12,   0,    0 },  // 0x21 '!'
+  {     0,   0,   0,  12,   0,    0 },  // 0x22 '"'
+  {     0,   0,   0,  12,   0,    0 },  // 0x23 '#'
+  {     0,   0,   0,  12,   0,    0 },  // 0x24 '$'
+  {     0,   0,   0,  12,   0,    0 },  // 0x25 '%'
+  {     0,   0,   0,  12,   0,    0 },  // 0x26 '&'
+  {     0,   0,   0,  12,   0,    0 },  // 0x27 "'"
+  {     0,   0,   0,  12,   0,    0 },  // 0x28 '('
+  {     0,   0,   0,  12,   0,    0 },  // 0x29 ')'
+  {     0,   0,   0,  12,   0,    0 },  // 0x2A '*'
+  {     0,   0,   0,  12,   0,    0 },  // 0x2B '+'
+  {     0,   0,   0,  12,   0,    0 },  // 0x2C ','
+  {     1,   8,   3,  12,   2,   -9 },  // 0x2D '-'
+  {     0,   0,   0,  12,   0,    0 },  // 0x2E '.'
+  {     0,   0,   0,  12,   0,    0 },  // 0x2F '/'
+  {     9,  10,  17,  12,   1,  -16 },  // 0x30 '0'
+  {    39,   6,  17,  12,   2,  -16 },  // 0x31 '1'
+  {    57,  10,  17,  12,   1,  -16 },  // 0x32 '2'
+  {    87,  10,  17,  12,   1,  -16 },  // 0x33 '3'
+  {   117,  10,  17,  12,   1,  -16 },  // 0x34 '4'
+  {   147,  10,  17,  12,   1,  -16 },  // 0x35 '5'
+  {   177,  10,  17,  12,   1,  -16 },  // 0x36 '6'
+  {   207,  10,  17,  12,   1,  -16 },  // 0x37 '7'
+  {   237,  10,  17,  12,   1,  -16 },  // 0x38 '8'
+  {   267,  10,  17,  12,   1,  -16 },  // 0x39 '9'
+};
+
+const RotatedFont font_monofonto12 PROGMEM = { font_monofonto12_bitmap, font_monofonto12_glyphs, 0x20, 0x39, 28 };
+
+// advance, cap height, ascent, descent, line height
+constexpr FontMetrics font_monofonto12_metrics = { 12, 16, 16, 1, 28 };
+
+
+// font_monofonto18 from Monofonto18pt.h, 12 of 95 glyphs
+const uint8_t font_monofonto18_bitmap[] PROGMEM = {
+  0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x80,
+  0x7F, 0xFF, 0xFF, 0x80, 0xF8, 0x00, 0x07, 0xC0, 0xF0, 0x00, 0x03, 0xC0,
+  0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF8, 0x00, 0x07, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80,
+  0x1F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x00,
+  0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
+  0x3E, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0,
+  0x7F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0x00, 0x00, 0x40,
+  0x3F, 0x00, 0x01, 0xC0, 0x7F, 0x00, 0x07, 0xC0, 0x7F, 0x00, 0x0F, 0xC0,
+  0xF8, 0x00, 0x3F, 0xC0, 0xF0, 0x00, 0xFF, 0xC0, 0xF0, 0x03, 0xFF, 0xC0,
+  0xF0, 0x0F, 0xF7, 0xC0, 0xF8, 0x3F, 0xE7, 0xC0, 0x7F, 0xFF, 0x87, 0xC0,
+  0x7F, 0xFE, 0x07, 0xC0, 0x3F, 0xFC, 0x07, 0xC0, 0x1F, 0xF0, 0x07, 0xC0,
+  0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x0E, 0x00, 0x3E, 0x00,
+  0x3E, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x3F, 0x80, 0x7E, 0x00, 0x0F, 0x80,
+  0xF8, 0x00, 0x07, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0,
+  0xF0, 0x1E, 0x03, 0xC0, 0xF8, 0x1E, 0x07, 0xC0, 0xFC, 0x7F, 0x0F, 0xC0,
+  0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xF7, 0xFF, 0x00, 0x1F, 0xE3, 0xFE, 0x00,
+  0x03, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00,
+  0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFE, 0xF0, 0x00, 0x03, 0xF8, 0xF0, 0x00,
+  0x0F, 0xE0, 0xF0, 0x00, 0x3F, 0x80, 0xF0, 0x00, 0xFE, 0x00, 0xF0, 0x00,
+  0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xF0, 0x00,
+  0x00, 0x00, 0xF0, 0x00, 0xFF, 0xFE, 0x06, 0x00, 0xFF, 0xFE, 0x0F, 0x00,
+  0xFF, 0xFE, 0x1F, 0x80, 0xFF, 0xFE, 0x0F, 0xC0, 0xF0, 0x3C, 0x07, 0xC0,
+  0xF0, 0x78, 0x03, 0xC0, 0xF0, 0x78, 0x03, 0xC0, 0xF0, 0x78, 0x03, 0xC0,
+  0xF0, 0x7C, 0x07, 0xC0, 0xF0, 0x7E, 0x0F, 0x80, 0xF0, 0x3F, 0xFF, 0x80,
+  0xF0, 0x3F, 0xFF, 0x00, 0xF0, 0x0F, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00,
+  0x00, 0x00, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x00,
+  0x00, 0x7F, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFE, 0x07, 0xC0,
+  0x1F, 0xFC, 0x03, 0xC0, 0x7F, 0xFC, 0x03, 0xC0, 0xFF, 0x3C, 0x03, 0xC0,
+  0xFC, 0x3E, 0x07, 0xC0, 0xF0, 0x3F, 0x0F, 0x80, 0xE0, 0x1F, 0xFF, 0x80,
+  0x80, 0x1F, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00,
+  0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xC0,
+  0xF0, 0x00, 0x07, 0xC0, 0xF0, 0x00, 0x3F, 0xC0, 0xF0, 0x01, 0xFF, 0xC0,
+  0xF0, 0x07, 0xFF, 0xC0, 0xF0, 0x3F, 0xFF, 0x00, 0xF1, 0xFF, 0xF8, 0x00,
+  0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
+  0xFF, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x07, 0x83, 0xFE, 0x00,
+  0x3F, 0xE7, 0xFF, 0x00, 0x7F, 0xF7, 0xFF, 0x80, 0x7F, 0xFF, 0x9F, 0x80,
+  0xF8, 0x3E, 0x07, 0xC0, 0xF0, 0x1C, 0x03, 0xC0, 0xF0, 0x1C, 0x03, 0xC0,
+  0xF0, 0x1C, 0x03, 0xC0, 0xF8, 0x1C, 0x07, 0xC0, 0x7C, 0x7E, 0x0F, 0xC0,
+  0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xF7, 0xFF, 0x80, 0x1F, 0xE3, 0xFF, 0x00,
+  0x00, 0x01, 0xFC, 0x00, 0x01, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
+  0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0xC0, 0x7F, 0xFF, 0x01, 0xC0,
+  0xF8, 0x1F, 0x07, 0xC0, 0xF0, 0x0F, 0x1F, 0xC0, 0xF0, 0x0F, 0x7F, 0xC0,
+  0xF0, 0x0F, 0xFF, 0x00, 0xF8, 0x1F, 0xFC, 0x00, 0x7C, 0x3F, 0xF0, 0x00,
+  0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x1F, 0xFE, 0x00, 0x00,
+  0x07, 0xF0, 0x00, 0x00,
+};
+
+const RotatedGlyph font_monofonto18_glyphs[] PROGMEM = {
+  {     0,   1,   1,  18,   0,    0 },  // 0x20 ' '
+  {     0,   0,   0,  18,   0,    0 },  // 0x21 '!'
+  {     0,   0,   0,  18,   0,    0 },  // 0x22 '"'
+  {     0,   0,   0,  18,   0,    0 },  // 0x23 '#'
+  {     0,   0,   0,  18,   0,    0 },  // 0x24 '$'
+  {     0,   0,   0,  18,   0,    0 },  // 0x25 '%'
+  {     0,   0,   0,  18,   0,    0 },  // 0x26 '&'
+  {     0,   0,   0,  18,   0,    0 },  // 0x27 "'"
+  {     0,   0,   0,  18,   0,    0 },  // 0x28 '('
+  {     0,   0,   0,  18,   0,    0 },  // 0x29 ')'
+  {     0,   0,   0,  18,   0,    0 },  // 0x2A '*'
+  {     0,   0,   0,  18,   0,    0 },  // 0x2B '+'
+  {     0,   0,   0,  18,   0,    0 },  // 0x2C ','
+  {     1,  11,   4,  18,   3,  -14 },  // 0x2D '-'
+  {     0,   0,   0,  18,   0,    0 },  // 0x2E '.'
+  {     0,   0,   0,  18,   0,    0 },  // 0x2F '/'
+  {    12,  14,  26,  18,   2,  -25 },  // 0x30 '0'
+  {    68,   9,  26,  18,   3,  -25 },  // 0x31 '1'
+  {   104,  14,  26,  18,   2,  -25 },  // 0x32 '2'
+  {   160,  15,  26,  18,   1,  -25 },  // 0x33 '3'
+  {   220,  15,  26,  18,   1,  -25 },  // 0x34 '4'
+  {   280,  14,  26,  18,   2,  -25 },  // 0x35 '5'
+  {   336,  15,  26,  18,   1,  -25 },  // 0x36 '6'
+  {   396,  16,  26,  18,   1,  -25 },  // 0x37 '7'
+  {   460,  15,  26,  18,   1,  -25 },  // 0x38 '8'
+  {   520,  15,  26,  18,   1,  -25 },  // 0x39 '9'
+};
+
+const RotatedFont font_monofonto18 PROGMEM = { font_monofonto18_bitmap, font_monofonto18_glyphs, 0x20, 0x39, 42 };
+
+// advance, cap height, ascent, descent, line height
+constexpr FontMetrics font_monofonto18_metrics = { 18, 25, 25, 1, 42 };
+
+
+// font_meteocons8 from MeteoCons8pt.h, 1 of 95 glyphs
+const uint8_t font_meteocons8_bitmap[] PROGMEM = {
+  0x40, 0xA0, 0xC0, 0x00, 0x78, 0x84, 0x84, 0x84,
+};
+
+const RotatedGlyph font_meteocons8_glyphs[] PROGMEM = {
+  {     0,   8,   6,  16,   4,   -9 },  // 0x2A '*'
+};
+
+const RotatedFont font_meteocons8 PROGMEM = { font_meteocons8_bitmap, font_meteocons8_glyphs, 0x2A, 0x2A, 16 };
+
+// advance, cap height, ascent, descent, line height
+constexpr FontMetrics font_meteocons8_metrics = { 16, 14, 9, 0, 16 };
+
+
+// font_meteocons10 from MeteoCons10pt.h, 10 of 95 glyphs
+const uint8_t font_meteocons10_bitmap[] PROGMEM = {
+  0x7E, 0x20, 0x18, 0x0C, 0x7E, 0x00, 0x01, 0x0E, 0x70, 0x80, 0x06, 0x1C,
+  0x64, 0x74, 0x1E, 0x02, 0x01, 0x00, 0x01, 0x00, 0x30, 0x04, 0x10, 0x08,
+  0x03, 0xC0, 0x04, 0x20, 0x08, 0x10, 0xC8, 0x17, 0x08, 0x10, 0x08, 0x30,
+  0x04, 0x60, 0x03, 0xC0, 0x10, 0x08, 0x30, 0x04, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x8F, 0x80, 0x00, 0x98, 0xC0, 0x20, 0x30, 0x60, 0x30, 0x20, 0x20,
+  0x03, 0xE0, 0x20, 0x04, 0x70, 0x60, 0x08, 0x40, 0x20, 0xE8, 0x80, 0x10,
+  0x08, 0x80, 0x10, 0x0C, 0x80, 0x10, 0x06, 0x80, 0x10, 0x03, 0x80, 0x10,
+  0x10, 0x40, 0x20, 0x20, 0xC0, 0x60, 0x00, 0xA0, 0x20, 0x00, 0xA0, 0x20,
+  0x00, 0x20, 0x20, 0x00, 0x30, 0x60, 0x00, 0x18, 0xC0, 0x00, 0x0F, 0x00,
+  0x0E, 0x94, 0x10, 0x94, 0x20, 0x94, 0x20, 0x94, 0x20, 0x94, 0x60, 0x94,
+  0x40, 0x94, 0xC0, 0x94, 0x80, 0x94, 0x80, 0x94, 0x80, 0x94, 0x80, 0x94,
+  0xC0, 0x94, 0x40, 0x94, 0x60, 0x94, 0x20, 0x94, 0x20, 0x94, 0x20, 0x94,
+  0x10, 0x94, 0x0E, 0x94, 0x07, 0x80, 0x08, 0x40, 0x10, 0x20, 0x10, 0x20,
+  0x10, 0x20, 0x30, 0x20, 0x60, 0x20, 0x40, 0x30, 0x80, 0x10, 0x80, 0x10,
+  0x80, 0x10, 0x80, 0x10, 0x40, 0x30, 0x60, 0x20, 0x30, 0x20, 0x10, 0x20,
+  0x10, 0x20, 0x10, 0x20, 0x08, 0x40, 0x07, 0x80, 0x07, 0x80, 0x00, 0x08,
+  0x40, 0x00, 0x10, 0x20, 0x00, 0x10, 0x20, 0x00, 0x10, 0x20, 0x00, 0x30,
+  0x20, 0x00, 0x40, 0x20, 0x00, 0x40, 0x30, 0x00, 0x80, 0x16, 0xC0, 0x80,
+  0x1F, 0x80, 0x80, 0x13, 0x00, 0x80, 0x10, 0x00, 0x40, 0x30, 0x00, 0x40,
+  0x20, 0x00, 0x30, 0x20, 0x00, 0x10, 0x20, 0x00, 0x10, 0x20, 0x00, 0x10,
+  0x20, 0x00, 0x08, 0x40, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x18,
+  0xC0, 0x00, 0x30, 0x60, 0x00, 0x20, 0x20, 0x00, 0x20, 0x20, 0x00, 0x20,
+  0x20, 0x00, 0x40, 0x20, 0x00, 0xC0, 0x30, 0x00, 0x80, 0x10, 0x00, 0x80,
+  0x17, 0x80, 0x80, 0x13, 0x80, 0x80, 0x10, 0x00, 0xC0, 0x30, 0x00, 0x40,
+  0x20, 0x00, 0x20, 0x20, 0x00, 0x20, 0x20, 0x00, 0x20, 0x20, 0x00, 0x30,
+  0x60, 0x00, 0x18, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x07, 0x80, 0x00, 0x08,
+  0xC0, 0x00, 0x10, 0x60, 0x00, 0x10, 0x20, 0x00, 0x10, 0x2F, 0x00, 0x30,
+  0x27, 0x00, 0x60, 0x20, 0x00, 0x40, 0x30, 0x00, 0x80, 0x10, 0x00, 0x80,
+  0x10, 0xF0, 0x80, 0x10, 0x70, 0x80, 0x10, 0x00, 0x40, 0x30, 0x00, 0x60,
+  0x20, 0x00, 0x30, 0x21, 0xC0, 0x10, 0x20, 0xC0, 0x10, 0x20, 0x00, 0x10,
+  0x60, 0x00, 0x08, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x0C,
+  0xC2, 0x00, 0x18, 0x27, 0x00, 0x10, 0x2D, 0x00, 0x10, 0x23, 0x00, 0x30,
+  0x20, 0x00, 0x60, 0x30, 0x00, 0x40, 0x11, 0x60, 0xC0, 0x19, 0xC0, 0xC0,
+  0x1B, 0x70, 0xC0, 0x1B, 0x70, 0xC0, 0x19, 0xC0, 0x40, 0x11, 0x60, 0x60,
+  0x30, 0x00, 0x30, 0x20, 0x00, 0x10, 0x21, 0x80, 0x10, 0x22, 0x80, 0x18,
+  0x23, 0xC0, 0x0C, 0xC0, 0x80, 0x07, 0x80, 0x00, 0x00, 0xF8, 0x01, 0x8C,
+  0x03, 0x06, 0x02, 0x02, 0x02, 0x02, 0x1E, 0x06, 0x14, 0x02, 0x2C, 0x03,
+  0x28, 0x01, 0x68, 0x01, 0xC8, 0x01, 0x88, 0x01, 0x8C, 0x03, 0x84, 0x06,
+  0xC6, 0x02, 0x62, 0x02, 0x22, 0x02, 0x23, 0x06, 0x11, 0x8C, 0x0E, 0xF8,
+};
+
+const RotatedGlyph font_meteocons10_glyphs[] PROGMEM = {
+  {     0,  16,   8,  20,   2,  -12 },  // 0x29 ')'
+  {     0,   0,   0,  20,   0,    0 },  // 0x2A '*'
+  {     0,   0,   0,  20,   0,    0 },  // 0x2B '+'
+  {     0,   0,   0,  20,   0,    0 },  // 0x2C ','
+  {     0,   0,   0,  20,   0,    0 },  // 0x2D '-'
+  {     0,   0,   0,  20,   0,    0 },  // 0x2E '.'
+  {     0,   0,   0,  20,   0,    0 },  // 0x2F '/'
+  {     0,   0,   0,  20,   0,    0 },  // 0x30 '0'
+  {     0,   0,   0,  20,   0,    0 },  // 0x31 '1'
+  {     0,   0,   0,  20,   0,    0 },  // 0x32 '2'
+  {     0,   0,   0,  20,   0,    0 },  // 0x33 '3'
+  {     0,   0,   0,  20,   0,    0 },  // 0x34 '4'
+  {     0,   0,   0,  20,   0,    0 },  // 0x35 '5'
+  {     0,   0,   0,  20,   0,    0 },  // 0x36 '6'
+  {     0,   0,   0,  20,   0,    0 },  // 0x37 '7'
+  {     0,   0,   0,  20,   0,    0 },  // 0x38 '8'
+  {     0,   0,   0,  20,   0,    0 },  // 0x39 '9'
+  {     0,   0,   0,  20,   0,    0 },  // 0x3A ':'
+  {     0,   0,   0,  20,   0,    0 },  // 0x3B ';'
+  {     0,   0,   0,  20,   0,    0 },  // 0x3C '<'
+  {     0,   0,   0,  20,   0,    0 },  // 0x3D '='
+  {     0,   0,   0,  20,   0,    0 },  // 0x3E '>'
+  {     0,   0,   0,  20,   0,    0 },  // 0x3F '?'
+  {     0,   0,   0,  20,   0,    0 },  // 0x40 '@'
+  {     0,   0,   0,  20,   0,    0 },  // 0x41 'A'
+  {    16,  16,  16,  20,   2,  -16 },  // 0x42 'B'
+  {     0,   0,   0,  20,   0,    0 },  // 0x43 'C'
+  {     0,   0,   0,  20,   0,    0 },  // 0x44 'D'
+  {     0,   0,   0,  20,   0,    0 },  // 0x45 'E'
+  {     0,   0,   0,  20,   0,    0 },  // 0x46 'F'
+  {     0,   0,   0,  20,   0,    0 },  // 0x47 'G'
+  {    48,  20,  20,  20,   0,  -18 },  // 0x48 'H'
+  {     0,   0,   0,  20,   0,    0 },  // 0x49 'I'
+  {     0,   0,   0,  20,   0,    0 },  // 0x4A 'J'
+  {     0,   0,   0,  20,   0,    0 },  // 0x4B 'K'
+  {   108,  20,  14,  20,   0,  -15 },  // 0x4C 'L'
+  {     0,   0,   0,  20,   0,    0 },  // 0x4D 'M'
+  {   148,  20,  12,  20,   0,  -14 },  // 0x4E 'N'
+  {   188,  20,  19,  20,   0,  -18 },  // 0x4F 'O'
+  {     0,   0,   0,  20,   0,    0 },  // 0x50 'P'
+  {   248,  20,  17,  20,   0,  -16 },  // 0x51 'Q'
+  {   308,  20,  20,  20,   0,  -18 },  // 0x52 'R'
+  {     0,   0,   0,  20,   0,    0 },  // 0x53 'S'
+  {     0,   0,   0,  20,   0,    0 },  // 0x54 'T'
+  {     0,   0,   0,  20,   0,    0 },  // 0x55 'U'
+  {     0,   0,   0,  20,   0,    0 },  // 0x56 'V'
+  {   368,  20,  20,  20,   0,  -18 },  // 0x57 'W'
+  {     0,   0,   0,  20,   0,    0 },  // 0x58 'X'
+  {   428,  20,  16,  20,   0,  -14 },  // 0x59 'Y'
+};
+
+const RotatedFont font_meteocons10 PROGMEM = { font_meteocons10_bitmap, font_meteocons10_glyphs, 0x29, 0x59, 20 };
+
+// advance, cap height, ascent, descent, line height
+constexpr FontMetrics font_meteocons10_metrics = { 20, 18, 18, 2, 20 };
+
+
+// font_cousine6 from Cousine6pt.h, 95 of 95 glyphs
+const uint8_t font_cousine6_bitmap[] PROGMEM = {
+  0x00, 0xFD, 0xF0, 0x00, 0xF0, 0x04, 0x2F, 0xF4, 0x24, 0x3F, 0xE4, 0x20,
+  0x01, 0x00, 0x71, 0x80, 0x48, 0x80, 0xFF, 0xC0, 0x48, 0x80, 0x65, 0x80,
+  0x02, 0x00, 0xF0, 0x93, 0xF4, 0x18, 0x2F, 0xC9, 0x0F, 0x06, 0x4B, 0xB9,
+  0x95, 0xE2, 0x0D, 0x01, 0xF0, 0x3F, 0x80, 0x60, 0xC0, 0x80, 0x20, 0x80,
+  0x20, 0x60, 0xC0, 0x3F, 0x80, 0x40, 0x58, 0xE0, 0x58, 0x00, 0x10, 0x10,
+  0xFE, 0x10, 0x10, 0x10, 0xE0, 0x80, 0x80, 0x80, 0x80, 0xC0, 0x01, 0x80,
+  0x06, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x00, 0x7E, 0x81, 0x91, 0x81,
+  0x7E, 0x41, 0x41, 0xFF, 0x01, 0x01, 0x01, 0x43, 0x85, 0x89, 0x99, 0x71,
+  0x42, 0x81, 0x91, 0x91, 0x6E, 0x0C, 0x34, 0x44, 0xFF, 0x04, 0xF2, 0x91,
+  0x91, 0x91, 0x8E, 0x7E, 0xD1, 0x91, 0x91, 0x4E, 0x80, 0x83, 0x8E, 0xB0,
+  0xC0, 0x6E, 0x91, 0x91, 0x91, 0x6E, 0x72, 0x89, 0x89, 0x8B, 0x7E, 0xC6,
+  0x01, 0x80, 0xC6, 0x00, 0x20, 0x50, 0x50, 0x50, 0x88, 0x90, 0x90, 0x90,
+  0x90, 0x90, 0x88, 0x50, 0x50, 0x50, 0x20, 0xC0, 0x80, 0x8D, 0x98, 0x70,
+  0x1F, 0x00, 0x60, 0xC0, 0x8F, 0x20, 0x91, 0x20, 0x9F, 0x20, 0x51, 0x40,
+  0x3E, 0x00, 0x01, 0x0E, 0x74, 0x84, 0x74, 0x0E, 0x01, 0xFF, 0x91, 0x91,
+  0x91, 0x6F, 0x04, 0x7E, 0x83, 0x81, 0x81, 0x43, 0x00, 0xFF, 0x81, 0x81,
+  0xC3, 0x7E, 0xFF, 0x91, 0x91, 0x91, 0x91, 0xFF, 0x90, 0x90, 0x90, 0x90,
+  0x7E, 0x81, 0x81, 0x89, 0x4F, 0xFF, 0x10, 0x10, 0x10, 0xFF, 0x81, 0x81,
+  0xFF, 0x81, 0x81, 0x02, 0x01, 0x81, 0xFF, 0xFC, 0xFF, 0x10, 0x38, 0x44,
+  0x83, 0x01, 0xFF, 0x01, 0x01, 0x01, 0x01, 0xFF, 0x70, 0x08, 0x70, 0xFF,
+  0xFF, 0x60, 0x18, 0x06, 0xFF, 0x7E, 0x81, 0x81, 0x81, 0x7E, 0xFF, 0x88,
+  0x88, 0x88, 0x70, 0x7E, 0x00, 0x81, 0x00, 0x81, 0x80, 0x81, 0xC0, 0x7E,
+  0x40, 0xFF, 0x90, 0x90, 0x9C, 0xE3, 0x00, 0x00, 0x73, 0x91, 0x91, 0x89,
+  0x4F, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x80, 0x80, 0xFE, 0x01, 0x01, 0x01,
+  0xFE, 0x80, 0x70, 0x0E, 0x01, 0x0E, 0x70, 0x80, 0xE0, 0x1F, 0x0F, 0x30,
+  0x0F, 0x1F, 0xE0, 0x00, 0xC3, 0x6C, 0x18, 0x6C, 0xC3, 0x00, 0x80, 0xC0,
+  0x20, 0x1F, 0x20, 0xC0, 0x80, 0x01, 0x83, 0x8D, 0x99, 0xA1, 0xC1, 0x01,
+  0xFF, 0xE0, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0xC0, 0x00, 0x30, 0x00,
+  0x1C, 0x00, 0x06, 0x00, 0x01, 0x80, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20,
+  0xFF, 0xE0, 0x18, 0x60, 0x80, 0x60, 0x18, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x00, 0x80, 0x40, 0x5E, 0x92, 0x92, 0xD4, 0x7E, 0x02, 0xFF,
+  0x80, 0x11, 0x00, 0x20, 0x80, 0x20, 0x80, 0x1F, 0x00, 0x7C, 0x82, 0x82,
+  0x82, 0x44, 0x1F, 0x00, 0x20, 0x80, 0x20, 0x80, 0x11, 0x00, 0xFF, 0x80,
+  0x7C, 0x92, 0x92, 0x92, 0x74, 0x20, 0x00, 0x7F, 0x80, 0xA0, 0x00, 0xA0,
+  0x00, 0xA0, 0x00, 0x7C, 0x00, 0x82, 0x80, 0x82, 0x80, 0x44, 0x80, 0xFF,
+  0x00, 0xFF, 0x80, 0x10, 0x00, 0x20, 0x00, 0x20, 0x00, 0x1F, 0x80, 0x20,
+  0x80, 0x20, 0x80, 0xBF, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x60, 0xBF, 0xC0, 0xFF, 0x80, 0x04, 0x00, 0x0C,
+  0x00, 0x13, 0x00, 0x20, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x00,
+  0x80, 0x00, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0xFE, 0x40, 0x80, 0x80,
+  0x7E, 0x7C, 0x82, 0x82, 0x82, 0x7C, 0xFF, 0x80, 0x44, 0x00, 0x82, 0x00,
+  0x82, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x82, 0x00, 0x82, 0x00, 0x44, 0x00,
+  0xFF, 0x80, 0x80, 0x7E, 0xC0, 0x80, 0x80, 0x64, 0xB2, 0x92, 0x92, 0x4C,
+  0x20, 0x00, 0xFF, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0xFC, 0x02,
+  0x02, 0x04, 0xFE, 0x00, 0xE0, 0x1C, 0x02, 0x1C, 0xE0, 0x00, 0xE0, 0x1E,
+  0x1C, 0x20, 0x1E, 0x3E, 0xC0, 0x82, 0x6C, 0x10, 0x6C, 0x82, 0x00, 0x00,
+  0xE0, 0x80, 0x39, 0x80, 0x07, 0x00, 0x18, 0x00, 0xE0, 0x00, 0x00, 0x00,
+  0x86, 0x8A, 0x92, 0xE2, 0x82, 0x04, 0x00, 0x04, 0x00, 0xFB, 0xE0, 0x80,
+  0x20, 0x80, 0x20, 0xFF, 0xE0, 0x80, 0x20, 0x80, 0x20, 0xFB, 0xE0, 0x04,
+  0x00, 0x04, 0x00, 0x80, 0x80, 0xC0, 0x40, 0x40,
+};
+
+const RotatedGlyph font_cousine6_glyphs[] PROGMEM = {
+  {     0,   1,   1,   7,   0,    0 },  // 0x20 ' '
+  {     1,   1,   8,   7,   3,   -7 },  // 0x21 '!'
+  {     2,   3,   4,   7,   2,   -8 },  // 0x22 '"'
+  {     5,   7,   8,   7,   0,   -7 },  // 0x23 '#'
+  {    12,   7,  10,   7,   0,   -8 },  // 0x24 '$'
+  {    26,   7,   8,   7,   0,   -7 },  // 0x25 '%'
+  {    33,   7,   8,   7,   0,   -7 },  // 0x26 '&'
+  {    40,   1,   4,   7,   3,   -8 },  // 0x27 "'"
+  {    41,   3,  11,   7,   2,   -8 },  // 0x28 '('
+  {    47,   3,  11,   7,   2,   -8 },  // 0x29 ')'
+  {    53,   5,   5,   7,   1,   -8 },  // 0x2A '*'
+  {    58,   5,   7,   7,   1,   -7 },  // 0x2B '+'
+  {    63,   3,   4,   7,   1,   -1 },  // 0x2C ','
+  {    66,   3,   1,   7,   2,   -3 },  // 0x2D '-'
+  {    69,   1,   2,   7,   3,   -1 },  // 0x2E '.'
+  {    70,   5,   9,   7,   1,   -8 },  // 0x2F '/'
+  {    80,   5,   8,   7,   1,   -7 },  // 0x30 '0'
+  {    85,   6,   8,   7,   1,   -7 },  // 0x31 '1'
+  {    91,   5,   8,   7,   1,   -7 },  // 0x32 '2'
+  {    96,   5,   8,   7,   1,   -7 },  // 0x33 '3'
+  {   101,   5,   8,   7,   1,   -7 },  // 0x34 '4'
+  {   106,   5,   8,   7,   1,   -7 },  // 0x35 '5'
+  {   111,   5,   8,   7,   1,   -7 },  // 0x36 '6'
+  {   116,   5,   8,   7,   1,   -7 },  // 0x37 '7'
+  {   121,   5,   8,   7,   1,   -7 },  // 0x38 '8'
+  {   126,   5,   8,   7,   1,   -7 },  // 0x39 '9'
+  {   131,   1,   7,   7,   3,   -6 },  // 0x3A ':'
+  {   132,   2,   9,   7,   2,   -6 },  // 0x3B ';'
+  {   136,   5,   5,   7,   1,   -6 },  // 0x3C '<'
+  {   141,   5,   4,   7,   1,   -5 },  // 0x3D '='
+  {   146,   5,   5,   7,   1,   -6 },  // 0x3E '>'
+  {   151,   5,   8,   7,   1,   -7 },  // 0x3F '?'
+  {   156,   7,  11,   7,   0,   -8 },  // 0x40 '@'
+  {   170,   7,   8,   7,   0,   -7 },  // 0x41 'A'
+  {   177,   6,   8,   7,   1,   -7 },  // 0x42 'B'
+  {   183,   6,   8,   7,   1,   -7 },  // 0x43 'C'
+  {   189,   5,   8,   7,   1,   -7 },  // 0x44 'D'
+  {   194,   5,   8,   7,   1,   -7 },  // 0x45 'E'
+  {   199,   5,   8,   7,   1,   -7 },  // 0x46 'F'
+  {   204,   5,   8,   7,   1,   -7 },  // 0x47 'G'
+  {   209,   5,   8,   7,   1,   -7 },  // 0x48 'H'
+  {   214,   5,   8,   7,   1,   -7 },  // 0x49 'I'
+  {   219,   5,   8,   7,   1,   -7 },  // 0x4A 'J'
+  {   224,   6,   8,   7,   1,   -7 },  // 0x4B 'K'
+  {   230,   5,   8,   7,   1,   -7 },  // 0x4C 'L'
+  {   235,   5,   8,   7,   1,   -7 },  // 0x4D 'M'
+  {   240,   5,   8,   7,   1,   -7 },  // 0x4E 'N'
+  {   245,   5,   8,   7,   1,   -7 },  // 0x4F 'O'
+  {   250,   5,   8,   7,   1,   -7 },  // 0x50 'P'
+  {   255,   5,  10,   7,   1,   -7 },  // 0x51 'Q'
+  {   265,   6,   8,   7,   1,   -7 },  // 0x52 'R'
+  {   271,   6,   8,   7,   0,   -7 },  // 0x53 'S'
+  {   277,   7,   8,   7,   0,   -7 },  // 0x54 'T'
+  {   284,   5,   8,   7,   1,   -7 },  // 0x55 'U'
+  {   289,   7,   8,   7,   0,   -7 },  // 0x56 'V'
+  {   296,   7,   8,   7,   0,   -7 },  // 0x57 'W'
+  {   303,   7,   8,   7,   0,   -7 },  // 0x58 'X'
+  {   310,   7,   8,   7,   0,   -7 },  // 0x59 'Y'
+  {   317,   7,   8,   7,   0,   -7 },  // 0x5A 'Z'
+  {   324,   4,  11,   7,   2,   -8 },  // 0x5B '['
+  {   332,   5,   9,   7,   1,   -8 },  // 0x5C '\\'
+  {   342,   4,  11,   7,   1,   -8 },  // 0x5D ']'
+  {   350,   5,   5,   7,   1,   -7 },  // 0x5E '^'
+  {   355,   7,   1,   7,   0,    2 },  // 0x5F '_'
+  {   362,   3,   2,   7,   2,   -9 },  // 0x60 '`'
+  {   365,   6,   7,   7,   1,   -6 },  // 0x61 'a'
+  {   371,   5,   9,   7,   1,   -8 },  // 0x62 'b'
+  {   381,   5,   7,   7,   1,   -6 },  // 0x63 'c'
+  {   386,   5,   9,   7,   1,   -8 },  // 0x64 'd'
+  {   396,   5,   7,   7,   1,   -6 },  // 0x65 'e'
+  {   401,   5,   9,   7,   1,   -8 },  // 0x66 'f'
+  {   411,   5,   9,   7,   1,   -6 },  // 0x67 'g'
+  {   421,   5,   9,   7,   1,   -8 },  // 0x68 'h'
+  {   431,   6,   9,   7,   1,   -8 },  // 0x69 'i'
+  {   443,   4,  11,   7,   1,   -8 },  // 0x6A 'j'
+  {   451,   5,   9,   7,   1,   -8 },  // 0x6B 'k'
+  {   461,   5,   9,   7,   1,   -8 },  // 0x6C 'l'
+  {   471,   5,   7,   7,   1,   -6 },  // 0x6D 'm'
+  {   476,   5,   7,   7,   1,   -6 },  // 0x6E 'n'
+  {   481,   5,   7,   7,   1,   -6 },  // 0x6F 'o'
+  {   486,   5,   9,   7,   1,   -6 },  // 0x70 'p'
+  {   496,   5,   9,   7,   1,   -6 },  // 0x71 'q'
+  {   506,   5,   7,   7,   1,   -6 },  // 0x72 'r'
+  {   511,   5,   7,   7,   1,   -6 },  // 0x73 's'
+  {   516,   5,   9,   7,   1,   -8 },  // 0x74 't'
+  {   526,   5,   7,   7,   1,   -6 },  // 0x75 'u'
+  {   531,   7,   7,   7,   0,   -6 },  // 0x76 'v'
+  {   538,   7,   7,   7,   0,   -6 },  // 0x77 'w'
+  {   545,   5,   7,   7,   1,   -6 },  // 0x78 'x'
+  {   550,   7,   9,   7,   0,   -6 },  // 0x79 'y'
+  {   564,   5,   7,   7,   1,   -6 },  // 0x7A 'z'
+  {   569,   5,  11,   7,   1,   -8 },  // 0x7B '{'
+  {   579,   1,  11,   7,   3,   -8 },  // 0x7C '|'
+  {   581,   5,  11,   7,   1,   -8 },  // 0x7D '}'
+  {   591,   5,   2,   7,   1,   -4 },  // 0x7E '~'
+};
+
+const RotatedFont font_cousine6 PROGMEM = { font_cousine6_bitmap, font_cousine6_glyphs, 0x20, 0x7E, 13 };
+
+// advance, cap height, ascent, descent, line height
+constexpr FontMetrics font_cousine6_metrics = { 7, 7, 9, 3, 13 };
+
+
+#endif
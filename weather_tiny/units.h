@@ -17,4 +17,9 @@ float kelv2cels1(float kelvin) {
     return round((kelvin -273.15)*10)/10.0;
 }
 
+
+int fraction2percent(float fraction) {
+    return round(fraction * 100);
+}
+
 #endif
@@ -28,21 +28,13 @@ struct View {
     String temp_low = "--";
     String temp_feel = "--";
     String temp_curr = "--";
-    String temp_unit = "*";
 
     String pressure = "----";
-    String pressure_unit = "hPa";
 
     String wind = "-";
     int wind_deg = 0;
-    String wind_unit = "Bft";
 
     String aq_pm25 = "---";
-    String aq_pm25_unit = "PM2.5";
-
-    String percip_time_unit = "hour";
-    String percip_unit = "temp";
-    String percic_pop_unit = "mm/%";
 
     String percip_time[PERCIP_SIZE];
     String percip_icon[PERCIP_SIZE];
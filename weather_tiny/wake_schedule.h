@@ -0,0 +1,125 @@
+#ifndef _wake_schedule_h
+#define _wake_schedule_h
+
+#include <time.h>
+#include "config.h"
+#include "api_request.h"
+#include "datetime.h"
+
+
+#define MINUTES_PER_DAY (24 * 60)
+
+static_assert(
+    MINUTES_PER_DAY % SLEEP_INTERVAL_MIN == 0 && MINUTES_PER_DAY % ACTIVE_SLEEP_INTERVAL_MIN == 0 &&
+    MINUTES_PER_DAY % NIGHT_SLEEP_INTERVAL_MIN == 0 && MINUTES_PER_DAY % LOW_BATTERY_SLEEP_INTERVAL_MIN == 0,
+    "sleep intervals have to divide 24 hours"
+);
+
+
+// Pressure reading the trend is measured against, one per location,
+// kept in RTC memory through deep sleep. Replaced once older than
+// PRESSURE_TREND_MAX_AGE_MIN, so the span is never shorter than an hour.
+struct PressureSample {
+    time_t ts;  // 0 when empty
+    int pressure;
+} ;
+
+RTC_DATA_ATTR struct PressureSample pressure_sample[MAX_LOCATION_CNT];
+
+
+// takes the pressure of a freshly fetched response
+void record_pressure(int loc, const WeatherResponse& weather) {
+    PressureSample& sample = pressure_sample[loc];
+    time_t now = time(NULL);
+
+    if (sample.ts == 0 || now - sample.ts > PRESSURE_TREND_MAX_AGE_MIN * 60 || now < sample.ts) {
+        sample.ts = now;
+        sample.pressure = weather.hourly[0].pressure;
+    }
+}
+
+
+// change of at least PRESSURE_TREND_HPA in 3 hours, scaled to the span of the sample
+bool is_pressure_changing_fast(int loc, const WeatherResponse& weather) {
+    const PressureSample& sample = pressure_sample[loc];
+    long age_min = (time(NULL) - sample.ts) / 60;
+
+    if (sample.ts == 0 || age_min < PRESSURE_TREND_MIN_AGE_MIN || age_min > PRESSURE_TREND_MAX_AGE_MIN) {
+        return false;
+    }
+    int change = abs(weather.hourly[0].pressure - sample.pressure);
+    return change * PRESSURE_TREND_MAX_AGE_MIN >= PRESSURE_TREND_HPA * age_min;
+}
+
+
+bool is_wet(int pop, float rain, float snow) {
+    return pop >= PRECIP_POP_THRESHOLD || rain + snow > 0;
+}
+
+
+// dry now and rain or snow likely within PRECIP_LOOKAHEAD_HOURS,
+// rain[0] is the coming hour
+bool is_precipitation_arriving(const WeatherResponse& weather) {
+    const WeatherResponseHourly& current = weather.hourly[0];
+
+    if (current.rain + current.snow > 0) {
+        return false;
+    }
+    for (int i = 0; i < PRECIP_LOOKAHEAD_HOURS; i++) {
+        if (is_wet(weather.rain[i].pop, weather.rain[i].rain, weather.rain[i].snow)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+// Minutes from now to the next sunrise, 0 during the day. The sun times
+// are those of the day the response was fetched, a cached response of an
+// earlier day still gives the right time of day.
+int minutes_to_sunrise(const WeatherResponse& weather) {
+    const long day_sec = 24 * 60 * 60;
+    const WeatherResponseHourly& current = weather.hourly[0];
+    long daylight_sec = current.suns_ts - current.sunr_ts;
+
+    if (current.sunr_ts == 0 || daylight_sec <= 0 || daylight_sec >= day_sec) {
+        return 0;  // no sunset today (polar day or night) or no data
+    }
+    long since_sunrise = ((time(NULL) - current.sunr_ts) % day_sec + day_sec) % day_sec;
+    if (since_sunrise < daylight_sec) {
+        return 0;
+    }
+    return (day_sec - since_sunrise) / 60;
+}
+
+
+// Minutes to sleep after this wake. A low battery stretches the interval
+// over everything else, nights are slept through until sunrise, weather
+// about to change shortens it.
+int next_sleep_interval_min(int loc, const WeatherResponse& weather, bool has_weather, int battery_percent) {
+    bool is_charging = battery_percent > 100;
+
+    if (!is_charging && battery_percent <= LOW_BATTERY_PERCENT) {
+        Serial.println("Sleep interval: low battery");
+        return LOW_BATTERY_SLEEP_INTERVAL_MIN;
+    }
+    if (!has_weather || !is_clock_set()) {
+        return SLEEP_INTERVAL_MIN;
+    }
+    if (minutes_to_sunrise(weather) >= NIGHT_SLEEP_INTERVAL_MIN) {
+        Serial.println("Sleep interval: night");
+        return NIGHT_SLEEP_INTERVAL_MIN;
+    }
+    if (is_precipitation_arriving(weather)) {
+        Serial.println("Sleep interval: precipitation arriving");
+        return ACTIVE_SLEEP_INTERVAL_MIN;
+    }
+    if (is_pressure_changing_fast(loc, weather)) {
+        Serial.println("Sleep interval: pressure changing fast");
+        return ACTIVE_SLEEP_INTERVAL_MIN;
+    }
+    return SLEEP_INTERVAL_MIN;
+}
+
+
+#endif
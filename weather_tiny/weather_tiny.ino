@@ -4,8 +4,8 @@
 #include <SPI.h>
 #include <GxEPD.h>
 
-#include <GxGDE0213B72B/GxGDE0213B72B.h> // 2.13" b/w
-// #include <GxDEPG0213BN/GxDEPG0213BN.h>  // 2.13" b/w newer panel
+#define PANEL PANEL_GDE0213B72B  // or PANEL_DEPG0213BN, see panel.h
+#include "panel.h"
 
 #include <GxIO/GxIO_SPI/GxIO_SPI.h>
 #include <GxIO/GxIO.h>
@@ -27,7 +27,8 @@ GxEPD_Class display(io, ELINK_RESET, ELINK_BUSY);
 // ----------------------------------
 // LIBS -----------------------------
 // ----------------------------------
-#define ARDUINOJSON_USE_DOUBLE 1
+// floats are enough for every value we read and the ESP32 FPU is single precision only
+#define ARDUINOJSON_USE_DOUBLE 0
 
 #include <WiFi.h>
 #include <HTTPClient.h>
@@ -37,6 +38,8 @@ GxEPD_Class display(io, ELINK_RESET, ELINK_BUSY);
 #include <AsyncTCP.h>
 #include <ESPAsyncWebServer.h>
 #include <rom/rtc.h> 
+#include <tcpip_adapter.h>
+#include <lwip/dhcp.h>
 #include <Preferences.h>
 
 #define ADC_PIN 35
@@ -46,12 +49,8 @@ GxEPD_Class display(io, ELINK_RESET, ELINK_BUSY);
 // FONTS ----------------------------
 // ----------------------------------
 
-#include <Fonts/Monofonto10pt.h>
-#include <Fonts/Monofonto12pt.h>
-#include <Fonts/Monofonto18pt.h>
-#include <Fonts/MeteoCons8pt.h>
-#include <Fonts/MeteoCons10pt.h>
-#include <Fonts/Cousine6pt.h>
+// the glyphs of Fonts/Monofonto10pt.h, Monofonto18pt.h and Cousine6pt.h drawn by display.h
+#include "gfx_fonts.h"
 
 // ----------------------------------
 // LOCAL FILES AND DECLARATIONS -----
@@ -62,7 +61,21 @@ GxEPD_Class display(io, ELINK_RESET, ELINK_BUSY);
 #include "config.h"
 #include "units.h"
 #include "api_request.h"
+#include "datetime.h"
+#include "dns_resolve.h"
+#include "backoff.h"
+#include "response_cache.h"
+#include "app_state.h"
+#include "json_stream.h"
+#include "json_extract.h"
+#include "onecall_fields.h"
+#include "chunked_stream.h"
+#include "gzip_stream.h"
 #include "display.h"
+#include "render.h"
+#include "chrome_bitmap.h"
+#include "display_refresh.h"
+#include "wake_schedule.h"
 #include "view.h"
 
 #define MEMORY_ID "mem"
@@ -84,41 +97,29 @@ int curr_loc = 0;
 struct WeatherRequest weather_request;
 struct AirQualityRequest airquality_request;
 struct GeocodingNominatimRequest location_request;
-struct TimeZoneDbRequest datetime_request;
+struct LocalDateTime datetime;
+
+RTC_DATA_ATTR struct WifiLease wifi_lease;
 
 int location_cnt = 0;
-struct Location location[2];
+struct Location location[MAX_LOCATION_CNT];
+
+// responses of the last fetch, one slot per location so requests for
+// several locations can run side by side
+WeatherResponse fetched_weather[MAX_LOCATION_CNT];
+AirQualityResponse fetched_air_quality[MAX_LOCATION_CNT];
 struct WifiCredentials wifi;
 struct View view;
+ScreenFrame frame;
 
-int get_mode(bool cached_mode=false);
-DynamicJsonDocument deserialize(WiFiClient& resp_stream, const int size, bool is_embeded=false);
+int get_mode();
+DynamicJsonDocument deserialize(WiFiClient& resp_stream, const int size, JsonDocument& filter, bool is_embeded=false, int content_length=-1);
 
 
 // ----------------------------------
 // FUNCTION DEFINITIONS -------------
 // ----------------------------------
 
-template<typename T>
-T value_or_default(JsonObject jobj, String key, T default_value) {
-    if (!jobj.containsKey(key)) {
-        return default_value;
-    } else {
-        return jobj[key];
-    }
-}
-
-
-template<typename T>
-T nested_value_or_default(JsonObject parent_jobj, String key, String nested_key, T default_value) {
-    if (!parent_jobj.containsKey(key)) {
-        return default_value;
-    } else {
-        return parent_jobj[key][nested_key];
-    }
-}
-
-
 void update_header_view(View& view, bool data_updated) {
     view.location = location[curr_loc].name.substring(0,7);
     view.battery_percent = get_battery_percent(analogRead(ADC_PIN));
@@ -128,7 +129,7 @@ void update_header_view(View& view, bool data_updated) {
         percent_display = 100;
     }
     view.battery_percent_display = String(percent_display) + "%";
-    view.datetime = header_datetime(&datetime_request.response.dt, data_updated);
+    view.datetime = header_datetime(&datetime.dt, data_updated);
 }
 
 
@@ -137,7 +138,6 @@ void update_air_quality_view(View& view, bool data_updated) {
         return;
     }
     view.aq_pm25 = left_pad(String(airquality_request.response.pm25), 3);
-    view.aq_pm25_unit = "PM2.5";
 }
 
 
@@ -145,36 +145,34 @@ void update_weather_view(View& view, bool data_updated) {
     if (!data_updated) {
         return;
     }
-    view.weather_icon = String(icon2meteo_font(weather_request.hourly[0].icon));
+    view.weather_icon = String(icon2meteo_font(weather_request.response.hourly[0].icon));
     
-    String descr = weather_request.hourly[0].descr;
+    String descr = weather_request.response.hourly[0].descr;
     view.weather_desc = capitalize(descr);
     
-    view.temp_curr = left_pad(String(weather_request.hourly[0].temp), 3);
-    view.temp_unit = '*';  // celsius
-    view.temp_high = "Hi" + left_pad(String(weather_request.hourly[0].max_t), 3);
-    view.temp_low = "Lo" + left_pad(String(weather_request.hourly[0].min_t), 3);
-    view.temp_feel = "Fl" + left_pad(String(weather_request.hourly[0].feel_t), 3);
+    view.temp_curr = left_pad(String(weather_request.response.hourly[0].temp), 3);
+    view.temp_high = "Hi" + left_pad(String(weather_request.response.hourly[0].max_t), 3);
+    view.temp_low = "Lo" + left_pad(String(weather_request.response.hourly[0].min_t), 3);
+    view.temp_feel = "Fl" + left_pad(String(weather_request.response.hourly[0].feel_t), 3);
 
-    view.pressure = left_pad(String(weather_request.hourly[0].pressure), 4);
-    view.pressure_unit = "hPa";
+    view.pressure = left_pad(String(weather_request.response.hourly[0].pressure), 4);
 
-    view.wind = left_pad(String(weather_request.hourly[0].wind_bft), 2);
-    view.wind_deg = weather_request.hourly[0].wind_deg;
+    view.wind = left_pad(String(weather_request.response.hourly[0].wind_bft), 2);
+    view.wind_deg = weather_request.response.hourly[0].wind_deg;
 
     for (int i = 0; i < PERCIP_SIZE; i++) {
-        view.percip_time[i] = ts2H(weather_request.rain[i].date_ts + datetime_request.response.gmt_offset);
-        view.percip_icon[i] = String(icon2meteo_font(weather_request.rain[i].icon));
+        view.percip_time[i] = ts2H(weather_request.response.rain[i].date_ts + weather_request.response.timezone_offset);
+        view.percip_icon[i] = String(icon2meteo_font(weather_request.response.rain[i].icon));
 
-        float cumulative_percip = weather_request.rain[i].snow + weather_request.rain[i].rain;
+        float cumulative_percip = weather_request.response.rain[i].snow + weather_request.response.rain[i].rain;
         if (cumulative_percip > 0) {
             view.percic_pop[i] = left_pad(fmt_2f1(cumulative_percip), 4);
         } else {
-            view.percic_pop[i] = left_pad(String(min(weather_request.rain[i].pop, 99)) + "%", 4);
+            view.percic_pop[i] = left_pad(String(min(weather_request.response.rain[i].pop, 99)) + "%", 4);
         }
 
         // temp TODO rename from percip
-        view.percip[i] = fmt_2f1(weather_request.rain[i].feel_t);
+        view.percip[i] = fmt_2f1(weather_request.response.rain[i].feel_t);
     }
 }
 
@@ -186,58 +184,16 @@ void update_location(GeocodingNominatimResponse& location_resp, JsonObject& jobj
 }
 
 
-void update_datetime(TimeZoneDbResponse& datetime_resp, JsonObject& jobj) {
-    datetime_resp.dt = jobj["timestamp"].as<int>();
-    datetime_resp.gmt_offset = jobj["gmtOffset"].as<int>();
-    datetime_resp.dst = jobj["dst"].as<int>();
-}
-
-
-void update_current_weather(WeatherResponseHourly& hourly, JsonObject& root) {
-    hourly.date_ts = root["current"]["dt"].as<int>();
-    hourly.sunr_ts = root["current"]["sunrise"].as<int>();
-    hourly.suns_ts = root["current"]["sunset"].as<int>();
-    hourly.temp = kelv2cels(root["current"]["temp"].as<float>());
-    hourly.feel_t = kelv2cels(root["current"]["feels_like"].as<float>());
-    hourly.max_t = kelv2cels(root["daily"][0]["temp"]["max"].as<float>());
-    hourly.min_t = kelv2cels(root["daily"][0]["temp"]["min"].as<float>());
-    hourly.pressure = root["current"]["pressure"].as<int>();
-    hourly.clouds = root["current"]["clouds"].as<int>();
-    hourly.wind_bft = wind_ms2bft(root["current"]["wind_speed"].as<float>());
-    hourly.wind_deg = root["current"]["wind_deg"].as<int>();
-    hourly.icon = String(root["current"]["weather"][0]["icon"].as<char*>()).substring(0, 2);
-    hourly.descr = root["current"]["weather"][0]["description"].as<char*>();
-    hourly.pop = round(root["hourly"][1]["pop"].as<float>() * 100);
-    hourly.snow = value_or_default(root["current"], "snow", 0.0f);
-    hourly.rain = value_or_default(root["current"], "rain", 0.0f);
-}
-
-
-void update_forecast_weather(WeatherResponseDaily& daily, JsonObject& root, const int day_offset) {
-    daily.date_ts = root["daily"][day_offset]["dt"].as<int>();
-    daily.max_t = kelv2cels(root["daily"][day_offset]["temp"]["max"].as<float>());
-    daily.min_t = kelv2cels(root["daily"][day_offset]["temp"]["min"].as<float>());
-    daily.wind_bft = wind_ms2bft(root["daily"][day_offset]["wind_speed"].as<float>());
-    daily.wind_deg = root["daily"][day_offset]["wind_deg"].as<int>();
-    daily.pop = round(root["daily"][day_offset]["pop"].as<float>() * 100);
-    daily.snow = value_or_default(root["daily"][day_offset], "snow", 0.0f);
-    daily.rain = value_or_default(root["daily"][day_offset], "rain", 0.0f);
-}
-
-
-void update_percip_forecast(WeatherResponseRainHourly& percip, JsonObject& root, const int hour_offset) {
-    percip.date_ts = root["hourly"][hour_offset]["dt"].as<int>();
-    percip.pop = round(root["hourly"][hour_offset]["pop"].as<float>() * 100);
-    percip.snow = nested_value_or_default(root["hourly"][hour_offset], "snow", "1h", 0.0f);
-    percip.rain = nested_value_or_default(root["hourly"][hour_offset], "rain", "1h", 0.0f);
-    percip.feel_t = kelv2cels1(root["hourly"][hour_offset]["feels_like"].as<float>());
-    percip.icon = String(root["hourly"][hour_offset]["weather"][0]["icon"].as<char*>()).substring(0, 2);
-}
-
-
 bool location_handler(WiFiClient& resp_stream, Request request) {
-    const int json_size = 20 * 1024;
-    DynamicJsonDocument doc = deserialize(resp_stream, json_size, true);
+    // positionstack is asked for one hit, room for a few in case it is ignored
+    StaticJsonDocument<JSON_OBJECT_SIZE(1) + JSON_ARRAY_SIZE(1) + JSON_OBJECT_SIZE(3)> filter;
+    filter["data"][0]["latitude"] = true;
+    filter["data"][0]["longitude"] = true;
+    filter["data"][0]["label"] = true;
+
+    const int max_hits = 10;
+    const int json_size = JSON_OBJECT_SIZE(1) + JSON_ARRAY_SIZE(max_hits) + max_hits * JSON_OBJECT_SIZE(3) + max_hits * 64;
+    DynamicJsonDocument doc = deserialize(resp_stream, json_size, filter, true, request.content_length);
     JsonObject api_resp = doc.as<JsonObject>();
 
     if (api_resp.isNull()) {
@@ -252,54 +208,49 @@ bool location_handler(WiFiClient& resp_stream, Request request) {
 }
 
 
-bool datetime_handler(WiFiClient& resp_stream, Request request) {
-    const int json_size = 10 * 1024;
-    DynamicJsonDocument doc = deserialize(resp_stream, json_size, true);
-    JsonObject api_resp = doc.as<JsonObject>();
-
-    if (api_resp.isNull()) {
-        return false;
-    }
-    datetime_request = TimeZoneDbRequest(request);
-    TimeZoneDbResponse& datetime_response = datetime_request.response;
-    update_datetime(datetime_response, api_resp);
-    datetime_response.print();
-    return true;
-}
-    
-
 bool weather_handler(WiFiClient& resp_stream, Request request) {
-    const int json_size = 35 * 1024;
-    DynamicJsonDocument doc = deserialize(resp_stream, json_size);
-    JsonObject api_resp = doc.as<JsonObject>();
-
-    if (api_resp.isNull()) {
+    // fields are extracted while the response arrives, no json document is built
+    Serial.print("\nExtracting weather json...");
+    unsigned long start = millis();
+    WeatherResponse weather = WeatherResponse();
+    ChunkedStream chunked_stream(resp_stream);
+    Stream& body = request.chunked ? (Stream&) chunked_stream : (Stream&) resp_stream;
+    GzipStream gzip_stream(body);
+    JsonPathReader reader(request.gzip_encoded ? (Stream&) gzip_stream : body);
+
+    if (!request.gzip_encoded) {
+        Serial.print("body not compressed...");
+    }
+    if (!reader.read(weather_value_visitor, &weather) || gzip_stream.failed() || chunked_stream.failed()) {
+        Serial.printf("extraction error after %u bytes\n", reader.bytes_read());
         return false;
     }
-    weather_request = WeatherRequest(request);
-    WeatherResponseHourly& hourly = weather_request.hourly[0];
-    WeatherResponseDaily& next_day = weather_request.daily[0];
-    WeatherResponseDaily& second_next_day = weather_request.daily[1];
-
-    update_current_weather(hourly, api_resp);
-    hourly.print();
-    update_forecast_weather(next_day, api_resp, 1);
-    next_day.print();
-    update_forecast_weather(second_next_day, api_resp, 2);
-    second_next_day.print();
-
-    for (int hour = 0; hour < 5; hour++) {
-        int offset = hour + 1;
-        update_percip_forecast(weather_request.rain[hour], api_resp, offset);
-        weather_request.rain[hour].print();
+    Serial.printf("extracted %u bytes in %lu ms, heap free: %u, min free: %u\n", 
+        reader.bytes_read(), millis() - start, ESP.getFreeHeap(), ESP.getMinFreeHeap());
+    if (request.gzip_encoded) {
+        Serial.printf("gzip body %u bytes, inflated %u bytes\n", gzip_stream.compressed_bytes(), gzip_stream.inflated_bytes());
     }
+    fetched_weather[request.location_id] = weather;
+    weather.print();
     return true;
 }
 
 
 bool air_quality_handler(WiFiClient& resp_stream, Request request) {
-    const int json_size = 6 * 1024;
-    DynamicJsonDocument doc = deserialize(resp_stream, json_size);
+    StaticJsonDocument<
+        JSON_OBJECT_SIZE(2) + JSON_OBJECT_SIZE(2) + 2 * JSON_OBJECT_SIZE(1)  // status, data.iaqi.pm25.v
+        + 2 * JSON_OBJECT_SIZE(1) + JSON_ARRAY_SIZE(1) + JSON_OBJECT_SIZE(1)  // data.forecast.daily.pm25[].max
+    > filter;
+    filter["status"] = true;
+    filter["data"]["iaqi"]["pm25"]["v"] = true;
+    filter["data"]["forecast"]["daily"]["pm25"][0]["max"] = true;
+
+    // forecast covers about a week
+    const int days = 10;
+    const int json_size = JSON_OBJECT_SIZE(2) + JSON_OBJECT_SIZE(2) + 2 * JSON_OBJECT_SIZE(1)
+        + 2 * JSON_OBJECT_SIZE(1) + JSON_ARRAY_SIZE(days) + days * JSON_OBJECT_SIZE(1)
+        + 128;
+    DynamicJsonDocument doc = deserialize(resp_stream, json_size, filter);
     JsonObject api_resp = doc.as<JsonObject>();
     
     if (api_resp.isNull()) {
@@ -308,35 +259,33 @@ bool air_quality_handler(WiFiClient& resp_stream, Request request) {
     if (!String(api_resp["status"].as<char*>()).equals("ok")) {
         return false;
     }
-    airquality_request = AirQualityRequest(request);
+    AirQualityResponse& air_quality = fetched_air_quality[request.location_id];
+    air_quality = AirQualityResponse();
     
     if (api_resp["data"]["iaqi"].containsKey("pm25")) {
-        airquality_request.response.pm25 = api_resp["data"]["iaqi"]["pm25"]["v"].as<int>();
+        air_quality.pm25 = api_resp["data"]["iaqi"]["pm25"]["v"].as<int>();
     } else if (api_resp["data"]["forecast"]["daily"].containsKey("pm25")) {
-        airquality_request.response.pm25 = api_resp["data"]["forecast"]["daily"]["pm25"][0]["max"].as<int>();
+        air_quality.pm25 = api_resp["data"]["forecast"]["daily"]["pm25"][0]["max"].as<int>();
     }
-    airquality_request.response.print();
+    air_quality.print();
     
     return true;
 }
 
 
-DynamicJsonDocument deserialize(WiFiClient& resp_stream, const int size, bool is_embeded) {
+DynamicJsonDocument deserialize(WiFiClient& resp_stream, const int size, JsonDocument& filter, bool is_embeded, int content_length) {
     // https://arduinojson.org/v6/assistant/
     Serial.print("\nDeserializing json, size:" + String(size) + " bytes...");
     DynamicJsonDocument doc(size);
     DeserializationError error;
     
     if (is_embeded) {
-        String stream_as_string = resp_stream.readString();
-        int begin = stream_as_string.indexOf('{');
-        int end = stream_as_string.lastIndexOf('}');
-        Serial.print("\nEmbeded json algorithm obtained document...\n");
-        String trimmed_json = stream_as_string.substring(begin, end+1);
-        Serial.println(trimmed_json);
-        error = deserializeJson(doc, trimmed_json);
+        // parse straight from the connection, no waiting for the stream timeout
+        EmbeddedJsonStream json_stream(resp_stream, content_length);
+        error = deserializeJson(doc, json_stream, DeserializationOption::Filter(filter));
+        Serial.print("\nEmbeded json streamed " + String(json_stream.json_length()) + " bytes...");
     } else {
-        error = deserializeJson(doc, resp_stream);
+        error = deserializeJson(doc, resp_stream, DeserializationOption::Filter(filter));
     }
     if (error) {
         Serial.print(F("\ndeserialization error:"));
@@ -344,6 +293,8 @@ DynamicJsonDocument deserialize(WiFiClient& resp_stream, const int size, bool is
     } else {
         Serial.println("deserialized.");
     }
+    Serial.printf("Json used %u of %d bytes, heap free: %u, min free: %u", 
+        doc.memoryUsage(), size, ESP.getFreeHeap(), ESP.getMinFreeHeap());
     Serial.println("");
     return doc;
 }
@@ -367,27 +318,121 @@ int get_battery_percent(int adc_value) {
 }
 
 
-bool http_request_data(WiFiClient& client, Request request, unsigned int retry=3) {
+// HTTPClient sends its own Accept-Encoding preferring identity with every HTTP/1.1
+// request and an added header only follows it, servers go by the first one.
+// Requests asking for gzip are written on the client for that, the response
+// headers are read up to the body. Returns the status code or HTTPC_ERROR_*.
+int http_get_gzip(WiFiClient& client, Request& request) {
+    request.content_length = -1;
+    request.gzip_encoded = false;
+    request.chunked = false;
+
+    if (!client.connected() && !client.connect(request.server.c_str(), 80)) {
+        return HTTPC_ERROR_CONNECTION_REFUSED;
+    }
+    // HTTP/1.1, servers commonly compress only for 1.1 requests (nginx gzip_http_version),
+    // the body may come chunked then and is decoded by the handler
+    String header = "GET " + request.path + " HTTP/1.1\r\n"
+        + "Host: " + request.server + "\r\n"
+        + "User-Agent: ESP32HTTPClient\r\n"
+        + "Accept-Encoding: gzip\r\n"
+        + "Connection: close\r\n\r\n";
+    if (client.print(header) != header.length()) {
+        return HTTPC_ERROR_SEND_HEADER_FAILED;
+    }
+    int http_code = 0;
+    unsigned long last_data_ms = millis();
+
+    while (client.connected() || client.available()) {
+        if (!client.available()) {
+            if (millis() - last_data_ms > HTTPCLIENT_DEFAULT_TCP_TIMEOUT) {
+                return HTTPC_ERROR_READ_TIMEOUT;
+            }
+            delay(1);
+            continue;
+        }
+        String line = client.readStringUntil('\n');
+        line.trim();
+        last_data_ms = millis();
+
+        if (http_code == 0) {
+            if (!line.startsWith("HTTP/1.")) {
+                return HTTPC_ERROR_NO_HTTP_SERVER;
+            }
+            http_code = line.substring(9, 12).toInt();  // HTTP/1.1 200 OK
+            continue;
+        }
+        if (line.length() == 0) {
+            Serial.printf("\nContent-Encoding: %s", request.gzip_encoded ? "gzip" : "identity");
+            return http_code;
+        }
+        int colon = line.indexOf(':');
+        if (colon < 0) {
+            continue;
+        }
+        String name = line.substring(0, colon);
+        String value = line.substring(colon + 1);
+        value.trim();
+
+        if (name.equalsIgnoreCase("Content-Length")) {
+            request.content_length = value.toInt();
+        } else if (name.equalsIgnoreCase("Content-Encoding")) {
+            request.gzip_encoded = value.equalsIgnoreCase("gzip");
+        } else if (name.equalsIgnoreCase("Transfer-Encoding")) {
+            request.chunked = value.equalsIgnoreCase("chunked");
+        }
+    }
+    return HTTPC_ERROR_CONNECTION_LOST;
+}
+
+
+bool http_request_data(WiFiClient& client, Request request, unsigned int retry=REQUEST_RETRY_CNT) {
     
     bool ret_val = false;
+    unsigned int attempt = 0;
 
     while(!ret_val && retry--) {
+        if (attempt++ > 0) {
+            delay(retry_backoff_ms(attempt - 1));
+        }
         ret_val = true;
         client.stop();
         HTTPClient http;
         Serial.printf("\nHTTP connecting to %s%s [retry left: %s]", request.server.c_str(), request.path.c_str(), String(retry).c_str());
-        http.begin(client, request.server, 80, request.path);
-        int http_code = http.GET();
+        uint32_t server_ip;
+        bool cached_connect = false;
+        if (dns_cache_get(request.server.c_str(), server_ip)) {
+            cached_connect = client.connect(IPAddress(server_ip), 80);
+            if (!cached_connect) {
+                Serial.printf("\nCached address %s failed", IPAddress(server_ip).toString().c_str());
+                dns_cache_forget(request.server.c_str());
+            }
+        }
+        int http_code;
+
+        if (request.accept_gzip) {
+            http_code = http_get_gzip(client, request);
+        } else {
+            // an already connected client is reused by HTTPClient, Host header keeps the name
+            http.begin(client, request.server, 80, request.path);
+            http_code = http.GET();
+            request.content_length = http.getSize();
+        }
         
         if(http_code == HTTP_CODE_OK) {
             Serial.println("\nHTTP connection established");
-            if (!request.handler(http.getStream(), request)) {
+            if (!request.handler(client, request)) {
                 ret_val = false;
             }
         } else {
             Serial.printf("\nHTTP connection failed %s, error: %s \n\n", String(http_code).c_str(), http.errorToString(http_code).c_str());
             ret_val = false;
         }
+        // a stale address may still accept connections, the next attempt connects by name
+        if (!ret_val && cached_connect) {
+            Serial.printf("\nRequest to cached address %s failed", IPAddress(server_ip).toString().c_str());
+            dns_cache_forget(request.server.c_str());
+        }
         client.stop();
         http.end();
     }
@@ -395,42 +440,246 @@ bool http_request_data(WiFiClient& client, Request request, unsigned int retry=3
 }
 
 
-bool connect_to_wifi(unsigned int retry=5) {
+// Circuit of an api host is checked once a wake, however many locations
+// request it. requested: location needs a response from the host.
+bool circuit_allows_wake(const Request& request, const bool* requested) {
+    bool any_requested = false;
+    for (int loc = 0; loc < location_cnt; loc++) {
+        any_requested = any_requested || requested[loc];
+    }
+    if (!any_requested) {
+        return false;
+    }
+    if (request.use_circuit_breaker && !circuit_allows(request.server.c_str())) {
+        Serial.printf("\nHTTP %s skipped, endpoint keeps failing\n", request.server.c_str());
+        return false;
+    }
+    return true;
+}
+
+
+// One result a wake for a host circuit_allows_wake let through,
+// the host counts as up when any location got its response
+void circuit_record_wake(const Request& request, const bool* requested, const bool* fetched) {
+    bool any_fetched = false;
+    for (int loc = 0; loc < location_cnt; loc++) {
+        any_fetched = any_fetched || (requested[loc] && fetched[loc]);
+    }
+    if (request.use_circuit_breaker) {
+        circuit_record(request.server.c_str(), any_fetched);
+    }
+}
+
+
+struct FetchJob {
+    Request request;
+    bool fetched = false;
+    SemaphoreHandle_t done = NULL;
+} ;
+
+
+void fetch_job(FetchJob& job) {
+    WiFiClient client;
+    job.fetched = http_request_data(client, job.request);
+
+    if (job.done != NULL) {
+        xSemaphoreGive(job.done);
+    }
+}
+
+
+void fetch_job_task(void* param) {
+    fetch_job(*(FetchJob*) param);
+    vTaskDelete(NULL);
+}
+
+
+void fetch_all(FetchJob* jobs, const int job_cnt) {
+    unsigned long start = millis();
+#if CONCURRENT_FETCH
+    for (int i = 0; i < job_cnt; i++) {
+        jobs[i].done = xSemaphoreCreateBinary();
+
+        if (xTaskCreate(fetch_job_task, "fetch", FETCH_TASK_STACK_SIZE, &jobs[i], 1, NULL) != pdPASS) {
+            Serial.println("\nFetch task not created, fetching in place.");
+            fetch_job(jobs[i]);
+        }
+    }
+    for (int i = 0; i < job_cnt; i++) {
+        xSemaphoreTake(jobs[i].done, portMAX_DELAY);
+        vSemaphoreDelete(jobs[i].done);
+        jobs[i].done = NULL;
+    }
+    Serial.printf("\nFetched %d requests concurrently in %lu ms\n", job_cnt, millis() - start);
+#else
+    for (int i = 0; i < job_cnt; i++) {
+        fetch_job(jobs[i]);
+    }
+    Serial.printf("\nFetched %d requests sequentially in %lu ms\n", job_cnt, millis() - start);
+#endif
+}
+
+
+#define WIFI_CONNECTED_BIT BIT0
+#define WIFI_DISCONNECTED_BIT BIT1
+
+EventGroupHandle_t wifi_event_group = NULL;
+unsigned long wifi_associated_ms = 0;
+
+
+void wifi_event_handler(WiFiEvent_t event) {
+    switch (event) {
+        case SYSTEM_EVENT_STA_CONNECTED:
+            wifi_associated_ms = millis();
+            break;
+        case SYSTEM_EVENT_STA_GOT_IP:
+            xEventGroupSetBits(wifi_event_group, WIFI_CONNECTED_BIT);
+            break;
+        case SYSTEM_EVENT_STA_DISCONNECTED:
+            xEventGroupSetBits(wifi_event_group, WIFI_DISCONNECTED_BIT);
+            break;
+        default:
+            break;
+    }
+}
+
+
+bool wait_for_wifi(unsigned long timeout_ms, bool stop_on_disconnect) {
+    unsigned long start = millis();
+    unsigned long elapsed = 0;
+
+    while (elapsed < timeout_ms) {
+        EventBits_t bits = xEventGroupWaitBits(
+            wifi_event_group, WIFI_CONNECTED_BIT | WIFI_DISCONNECTED_BIT, 
+            pdTRUE, pdFALSE, pdMS_TO_TICKS(timeout_ms - elapsed)
+        );
+        if (bits & WIFI_CONNECTED_BIT) {
+            return true;
+        }
+        if ((bits & WIFI_DISCONNECTED_BIT) && (stop_on_disconnect || WiFi.status() == WL_CONNECT_FAILED)) {
+            return false;
+        }
+        elapsed = millis() - start;
+    }
+    return false;
+}
+
+
+void print_wifi_timing(unsigned long start) {
+    unsigned long now = millis();
+    unsigned long associated = wifi_associated_ms >= start ? wifi_associated_ms - start : 0;
+    Serial.printf(
+        "Wifi connected. IP: %s, associated in %lu ms, got IP in %lu ms\n",
+        WiFi.localIP().toString().c_str(), associated, now - start
+    );
+}
+
+
+// lease time granted by the DHCP server, 0 when unknown
+uint32_t dhcp_lease_sec() {
+    void* netif = NULL;
 
-    int wifi_conn_status = WL_IDLE_STATUS;
+    if (tcpip_adapter_get_netif(TCPIP_ADAPTER_IF_STA, &netif) != ESP_OK || netif == NULL) {
+        return 0;
+    }
+    struct dhcp* dhcp = netif_dhcp_data((struct netif*) netif);
+    return dhcp != NULL ? dhcp->offered_t0_lease : 0;
+}
+
+
+void save_wifi_lease() {
+    uint32_t lease_sec = dhcp_lease_sec();
+    uint32_t max_reuse_sec = WIFI_LEASE_MAX_REUSE_MIN * 60;
+
+    wifi_lease.valid = true;
+    wifi_lease.obtained_ts = is_clock_set() ? time(NULL) : 0;
+    wifi_lease.reuse_sec = lease_sec > 0 ? min(lease_sec / 2, max_reuse_sec) : max_reuse_sec;
+    memcpy(wifi_lease.bssid, WiFi.BSSID(), sizeof(wifi_lease.bssid));
+    wifi_lease.channel = WiFi.channel();
+    wifi_lease.ip = WiFi.localIP();
+    wifi_lease.gateway = WiFi.gatewayIP();
+    wifi_lease.subnet = WiFi.subnetMask();
+    wifi_lease.dns = WiFi.dnsIP(0);
+    Serial.printf("DHCP lease %u s, address reused for %u s\n", lease_sec, wifi_lease.reuse_sec);
+}
+
+
+// a lease taken before the first clock sync gets its time once the clock is set
+void date_wifi_lease(unsigned long lease_age_ms) {
+    if (wifi_lease.valid && wifi_lease.obtained_ts == 0 && is_clock_set()) {
+        wifi_lease.obtained_ts = time(NULL) - lease_age_ms / 1000;
+    }
+}
+
+
+// The router may hand an expired address to another client, and with a static
+// config GOT_IP comes anyway. Past its reuse time the lease goes back to DHCP.
+bool is_wifi_lease_usable() {
+    if (!wifi_lease.valid || wifi_lease.obtained_ts == 0 || !is_clock_set()) {
+        return false;
+    }
+    time_t age = time(NULL) - wifi_lease.obtained_ts;
+    if (age < 0 || age >= (time_t) wifi_lease.reuse_sec) {
+        Serial.printf("\nWifi lease %ld s old, renewing with DHCP", (long) age);
+        return false;
+    }
+    return true;
+}
+
+
+bool fast_connect_to_wifi() {
+    Serial.println("\nFast reconnect to: " + wifi.ssid + " [channel: " + String(wifi_lease.channel) + "]");
+    unsigned long start = millis();
+    WiFi.config(IPAddress(wifi_lease.ip), IPAddress(wifi_lease.gateway), IPAddress(wifi_lease.subnet), IPAddress(wifi_lease.dns));
+    xEventGroupClearBits(wifi_event_group, WIFI_CONNECTED_BIT | WIFI_DISCONNECTED_BIT);
+    WiFi.begin(wifi.ssid.c_str(), wifi.pass.c_str(), wifi_lease.channel, wifi_lease.bssid);
+
+    if (wait_for_wifi(WIFI_FAST_CONNECT_TIMEOUT_MS, true)) {
+        print_wifi_timing(start);
+        return true;
+    }
+    Serial.printf("Fast reconnect failed after %lu ms, scanning with DHCP.\n", millis() - start);
+    wifi_lease.valid = false;
+    WiFi.disconnect();
+    WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);  // back to DHCP
+    return false;
+}
+
+
+bool connect_to_wifi(unsigned int retry=5) {
+    unsigned long radio_start = millis();
+    WiFi.persistent(false);  // credentials live in Preferences, no flash write on every begin
     WiFi.mode(WIFI_STA); // Access Point mode off
     WiFi.setAutoConnect(true);
     WiFi.setAutoReconnect(true);
 
-    while(wifi_conn_status != WL_CONNECTED && retry--) {
+    if (wifi_event_group == NULL) {
+        wifi_event_group = xEventGroupCreate();
+        WiFi.onEvent(wifi_event_handler);
+    }
+    Serial.printf("\nWifi radio on in %lu ms", millis() - radio_start);
+
+    if (WIFI_FAST_CONNECT && is_wifi_lease_usable() && fast_connect_to_wifi()) {
+        return true;
+    }
+    while(retry--) {
         Serial.println("\nConnecting to: " + wifi.ssid + " [retry left: " + retry +"]");
         unsigned long start = millis();
-        wifi_conn_status = WiFi.begin(wifi.ssid.c_str(), wifi.pass.c_str());
+        xEventGroupClearBits(wifi_event_group, WIFI_CONNECTED_BIT | WIFI_DISCONNECTED_BIT);
+        WiFi.begin(wifi.ssid.c_str(), wifi.pass.c_str());
         
-        while (true) {
-            if (millis() > start + 10000) { // 10s
-                break;
-            }
-            delay(100);
-    
-            wifi_conn_status = WiFi.status();
-            
-            if (wifi_conn_status == WL_CONNECTED) {
-                Serial.println("Wifi connected. IP: " + WiFi.localIP().toString());    
-                break;
-            } else if(wifi_conn_status == WL_CONNECT_FAILED) {
-                Serial.println("Wifi failed to connect.");
-                break;
-            }
-        }
-        if (wifi_conn_status == WL_CONNECTED) {
+        if (wait_for_wifi(10000, false)) {  // 10s
+            print_wifi_timing(start);
+            save_wifi_lease();
             return true;
         }
+        Serial.println("Wifi failed to connect.");
         delay(2000); // 2sec
     }
     return false;
 }
 
+
 void print_reset_reason(RESET_REASON reason) {
     switch ( reason) {
         case 1 : Serial.print("POWERON_RESET"); break;
@@ -453,7 +702,7 @@ void print_reset_reason(RESET_REASON reason) {
 }
 
 
-void wakeup_reason() {
+esp_sleep_wakeup_cause_t wakeup_reason() {
     esp_sleep_wakeup_cause_t wakeup_reason;
     wakeup_reason = esp_sleep_get_wakeup_cause();
     
@@ -463,11 +712,11 @@ void wakeup_reason() {
         case ESP_SLEEP_WAKEUP_EXT0 : 
             Serial.println("\nWakeup by ext signal RTC_IO -> GPIO39"); 
             if (get_mode() == OPERATING_MODE) {
-                // Toggle between 2 screens caused by button press WAKE_BTN_PIN
+                // Cycle through the location screens on button press WAKE_BTN_PIN
                 if (location_cnt > 1) {
-                    curr_loc = (curr_loc+1) % 2;
+                    curr_loc = (curr_loc+1) % location_cnt;
                     // save location
-                    save_location_to_memory(curr_loc);
+                    save_app_state();
                 }
             }        
             break;
@@ -487,22 +736,24 @@ void wakeup_reason() {
     Serial.print(",  CPU1 reset reason: ");
     print_reset_reason(rtc_get_reset_reason(1));
     Serial.println();
+    return wakeup_reason;
 }
 
 
 void enable_timed_sleep(int interval_minutes) {
     // sleep and wake up round minutes, ex every 15 mins
-    // will wake up at 7:15, 7:30, 7:45 etc.
+    // will wake up at 7:15, 7:30, 7:45 etc., every 120 mins at even hours
 
+    LocalDateTime now = local_datetime(datetime.gmt_offset);
     struct tm* timeinfo;
-    timeinfo = localtime(&datetime_request.response.dt);
-    int current_time_min = timeinfo->tm_min;
+    timeinfo = localtime(&now.dt);
+    int current_time_min = timeinfo->tm_hour * 60 + timeinfo->tm_min;  // of the day
     int current_time_sec = timeinfo->tm_sec;
     int sleep_minutes_left = interval_minutes - current_time_min % interval_minutes - 1;  // - 1 minute running in seconds
     int sleep_seconds_left = 60 - current_time_sec;
     int sleep_time_seconds = sleep_minutes_left * 60 + sleep_seconds_left;
     
-    long sleep_time_micro_sec = sleep_time_seconds * 1000 * 1000;
+    uint64_t sleep_time_micro_sec = (uint64_t) sleep_time_seconds * 1000 * 1000;  // 32 bits overflow past 35 minutes
     esp_sleep_enable_timer_wakeup(sleep_time_micro_sec);
     Serial.printf("\nWake up in %d minutes and %d seconds", sleep_minutes_left, sleep_seconds_left);
 }
@@ -533,6 +784,7 @@ void begin_deep_sleep() {
     gpio_deep_sleep_hold_en();
 
     // start sleep
+    cache_note_sleep_start();
     esp_deep_sleep_start();
 }
 
@@ -608,73 +860,102 @@ String create_validation_message(bool valid_wifi, bool valid_location_1, bool va
 }
 
 
-void read_config_from_memory() {
-    Serial.println("Read config from memory...");
+// Config in the per key layout of earlier versions, read once to migrate it
+void read_legacy_config_from_memory() {
+    Serial.println("Read legacy config from memory...");
     preferences.begin(MEMORY_ID, true);  // first param true means 'read only'
 
+    cached_MODE = preferences.getInt("mode", NOT_SET_MODE);
     wifi.ssid = preferences.getString("ssid");
     wifi.pass = preferences.getString("pass");
-    wifi.print();
-
     location_cnt = preferences.getInt("locations");  // global variable
-    Serial.println("Locations: " + String(location_cnt));
 
     location[0].name = preferences.getString("loc1", "");
     location[0].lat = preferences.getFloat("lat1", 0.0f);
     location[0].lon = preferences.getFloat("lon1", 0.0f);
-    location[0].print();
 
     if (location_cnt > 1) {
         location[1].name = preferences.getString("loc2", "");
         location[1].lat = preferences.getFloat("lat2", 0.0f);
         location[1].lon = preferences.getFloat("lon2", 0.0f);
-        location[1].print();
     }
     preferences.end();
+
+    preferences.begin(LOC_MEMORY_ID, true);
+    curr_loc = preferences.getInt("curr_loc");
+    preferences.end();
 }
 
 
-int read_location_from_memory() {
-    Serial.println("Read current location from memory...");
-    preferences.begin(LOC_MEMORY_ID, true);  // first param true means 'read only'
-    int location_id = preferences.getInt("curr_loc");
+void remove_legacy_config_from_memory() {
+    const char* keys[] = { "mode", "ssid", "pass", "locations", "loc1", "lat1", "lon1", "loc2", "lat2", "lon2" };
+
+    preferences.begin(MEMORY_ID, false);
+    for (const char* key : keys) {
+        preferences.remove(key);
+    }
     preferences.end();
-    return location_id;
-}
 
+    preferences.begin(LOC_MEMORY_ID, false);
+    preferences.clear();
+    preferences.end();
+}
 
-void save_config_to_memory() {
-    Serial.println("Save config to memory.");
-    
-    preferences.begin(MEMORY_ID, false);  // first param false means 'read/write'
 
+// Mode, config and current location written at once as one blob,
+// a brown-out leaves either the old or the new record behind.
+// false when the blob did not make it to NVS
+bool save_app_state() {
+    Serial.println("Save app state to memory.");
     wifi.print();
-    preferences.putString("ssid", wifi.ssid);
-    preferences.putString("pass", wifi.pass);
-
     Serial.println("Locations: " + String(location_cnt));
-    preferences.putInt("locations", location_cnt);  // global variable
+    for (int i = 0; i < location_cnt; i++) {
+        location[i].print();
+    }
+    store_app_state(cached_MODE, wifi, location, location_cnt, curr_loc);
 
-    location[0].print();
-    preferences.putString("loc1", location[0].name);
-    preferences.putFloat("lat1", location[0].lat);
-    preferences.putFloat("lon1", location[0].lon);
+    preferences.begin(MEMORY_ID, false);  // first param false means 'read/write'
+    size_t written = preferences.putBytes(APP_STATE_KEY, &app_state, sizeof(app_state));
+    preferences.end();
 
-    if (location_cnt > 1) {
-        location[1].print();
-        preferences.putString("loc2", location[1].name);
-        preferences.putFloat("lat2", location[1].lat);
-        preferences.putFloat("lon2", location[1].lon);
+    if (written != sizeof(app_state)) {
+        Serial.println("Saving app state failed");
+        return false;
     }
-    preferences.end();
+    return true;
 }
 
 
-void save_location_to_memory(int location_id) {
-    Serial.println("Save current location to memory...");
-    preferences.begin(LOC_MEMORY_ID, false);
-    preferences.putInt("curr_loc", location_id);
+// Mode, config and current location: from RTC memory on a wake from deep
+// sleep, from NVS after power on or when the RTC copy is damaged
+void restore_app_state() {
+    unsigned long start = micros();
+
+    if (is_app_state_valid()) {
+        cached_MODE = load_app_state(wifi, location, location_cnt, curr_loc);
+        Serial.printf("App state restored from RTC memory in %lu us\n", micros() - start);
+        return;
+    }
+    preferences.begin(MEMORY_ID, true);
+    size_t read = preferences.getBytes(APP_STATE_KEY, &app_state, sizeof(app_state));
     preferences.end();
+
+    if (read == sizeof(app_state) && is_app_state_valid()) {
+        cached_MODE = load_app_state(wifi, location, location_cnt, curr_loc);
+        Serial.printf("App state read from NVS in %lu us\n", micros() - start);
+        return;
+    }
+    invalidate_app_state();
+
+    // nothing saved yet, or saved by a version with one key per value
+    read_legacy_config_from_memory();
+    if (cached_MODE != NOT_SET_MODE) {
+        // the legacy keys stay the only copy until the blob is written, migration is retried next boot
+        if (save_app_state()) {
+            remove_legacy_config_from_memory();
+            Serial.printf("Legacy config migrated in %lu us\n", micros() - start);
+        }
+    }
 }
 
 
@@ -730,6 +1011,7 @@ void run_config_server() {
     display_config_mode(network, pass, ip);
     
     display.update();
+    invalidate_view_state();
 
     server.on("/config", HTTP_POST, [](AsyncWebServerRequest *request){
         bool valid_wifi = true;
@@ -754,8 +1036,11 @@ void run_config_server() {
                 location[1].name = location_2;
             }
 
-            save_config_to_memory();
-            set_mode(VALIDATING_MODE);
+            // mode goes into the same blob, one NVS write
+            cached_MODE = VALIDATING_MODE;
+            save_app_state();
+            wifi_lease.valid = false;
+            clear_response_cache();
             server.end();
             ESP.restart();
             return;
@@ -773,9 +1058,9 @@ void run_config_server() {
 void run_validating_mode() {
     server.end();
         
-    read_config_from_memory();
     display_validating_mode();
     display.update();
+    invalidate_view_state();
     
     if (connect_to_wifi()) {
         location_request.handler = location_handler;
@@ -800,13 +1085,15 @@ void run_validating_mode() {
                     location[1].lat = location_request.response.lat;
                     location[1].lon = location_request.response.lon;
 
-                    save_config_to_memory();
-                    set_mode_and_reboot(OPERATING_MODE);
+                    cached_MODE = OPERATING_MODE;
+                    save_app_state();
+                    ESP.restart();
                     return;
                 }
             } else {
-                save_config_to_memory();
-                set_mode_and_reboot(OPERATING_MODE);
+                cached_MODE = OPERATING_MODE;
+                save_app_state();
+                ESP.restart();
                 return;
             }
         }
@@ -815,52 +1102,179 @@ void run_validating_mode() {
 }
 
 
-void run_operating_mode() {
-    read_config_from_memory();
-    curr_loc = read_location_from_memory();
-    wakeup_reason();
+// Weather and air quality requests of one location, side by side.
+// Handlers put the responses in fetched_weather and fetched_air_quality.
+// refresh_daily false leaves the daily block out of the weather request.
+void fetch_location(int loc, bool refresh_weather, bool refresh_daily, bool refresh_aq, bool& is_weather_fetched, bool& is_aq_fetched) {
+    FetchJob jobs[2];
+    const char* hosts[2];
+    int job_cnt = 0;
 
-    if (connect_to_wifi()) {
-        WiFiClient client;
+    if (refresh_weather) {
+        weather_request.make_path(location[loc], refresh_daily);
+        weather_request.handler = weather_handler;
+        weather_request.location_id = loc;
+        hosts[job_cnt] = weather_request.server.c_str();
+        jobs[job_cnt++].request = weather_request;
+    }
+    if (refresh_aq) {
+        airquality_request.make_path(location[loc]);
+        airquality_request.handler = air_quality_handler;
+        airquality_request.location_id = loc;
+        hosts[job_cnt] = airquality_request.server.c_str();
+        jobs[job_cnt++].request = airquality_request;
+    }
+    if (job_cnt == 0) {
+        return;
+    }
+    dns_resolve_all(hosts, job_cnt, DNS_TIMEOUT_MS);
+    fetch_all(jobs, job_cnt);
 
-        datetime_request.make_path(location[curr_loc]);
-        datetime_request.handler = datetime_handler;
+    is_weather_fetched = refresh_weather && jobs[0].fetched;
+    is_aq_fetched = refresh_aq && jobs[job_cnt - 1].fetched;
+}
 
-        weather_request.make_path(location[curr_loc]);
-        weather_request.handler = weather_handler;
 
-        airquality_request.make_path(location[curr_loc]);
-        airquality_request.handler = air_quality_handler;
+// Renders the responses in weather_request and airquality_request and refreshes the panel
+void show_weather(bool has_weather, bool has_aq, bool is_current) {
+    // onecall offset follows daylight saving time of the location
+    datetime = local_datetime(has_weather ? weather_request.response.timezone_offset : 0);
+    datetime.print();
 
-        bool is_time_fetched = http_request_data(client, datetime_request);
-        bool is_weather_fetched = http_request_data(client, weather_request);
-        bool is_aq_fetched = http_request_data(client, airquality_request);
+    view = View();
 
-        view = View();
+    update_header_view(view, is_current); 
+    update_weather_view(view, has_weather);
+    update_air_quality_view(view, has_aq);
+        
+    Serial.println("\nUpdate display.");
+    unsigned long render_start = micros();
+    frame.load(chrome_bitmap);  // labels and outlines
+    render_header(frame, view);
+    render_weather(frame, view);
+    render_air_quality(frame, view);
+    Serial.printf("Frame rendered in %lu us\n", micros() - render_start);
+
+    if (refresh_display(frame)) {
+        delay(100); // too fast display powerDown displays blank (white)??
+    }
+}
 
-        update_header_view(view, is_time_fetched); 
-        update_weather_view(view, is_weather_fetched);
-        update_air_quality_view(view, is_aq_fetched);
-            
-        Serial.println("\nUpdate display.");
-        display_header(view);
-        display_weather(view);
-        display_air_quality(view);
+
+void run_operating_mode() {
+    bool is_location_switch = wakeup_reason() == ESP_SLEEP_WAKEUP_EXT0 && location_cnt > 1;
+
+    // sources still within their ttl are rendered from the cache without a request,
+    // the other location is refreshed in the same wifi session, ready for a switch
+    bool refresh_weather[MAX_LOCATION_CNT] = {};
+    bool refresh_daily[MAX_LOCATION_CNT] = {};
+    bool refresh_aq[MAX_LOCATION_CNT] = {};
+    bool is_weather_fetched[MAX_LOCATION_CNT] = {};
+    bool is_aq_fetched[MAX_LOCATION_CNT] = {};
+    bool refresh_any = false;
+    // a switch shows data younger than the ttl (the sleep interval for the weather) without a fetch
+    int slack_sec = is_location_switch ? 0 : timer_wake_slack_sec();
+
+    for (int loc = 0; loc < location_cnt; loc++) {
+        refresh_weather[loc] = !cache_is_fresh(response_cache.weather[loc], WEATHER_TTL_MIN, slack_sec);
+        refresh_daily[loc] = refresh_weather[loc] && !cache_daily_is_fresh(loc, slack_sec);
+        refresh_aq[loc] = !cache_is_fresh(response_cache.air_quality[loc], AIR_QUALITY_TTL_MIN, slack_sec);
+        refresh_any = refresh_any || refresh_weather[loc] || refresh_aq[loc];
+        Serial.printf("Location %d refresh weather: %d, daily: %d, air quality: %d\n",
+            loc, refresh_weather[loc], refresh_daily[loc], refresh_aq[loc]);
     }
 
-    display.update();
-    delay(100); // too fast display powerDown displays blank (white)??
+    // the switched to location shows up from the cache before the radio is on,
+    // marked not fresh until the requests below replace it
+    if (is_location_switch && (refresh_weather[curr_loc] || refresh_aq[curr_loc])
+            && cache_load(response_cache.weather[curr_loc], weather_request.response, CACHED_RESPONSE_MAX_AGE_MIN)) {
+        bool has_cached_aq = cache_load(response_cache.air_quality[curr_loc], airquality_request.response, CACHED_RESPONSE_MAX_AGE_MIN);
+        Serial.println("Location switched, showing cached data first");
+        show_weather(true, has_cached_aq, false);
+    }
+
+    bool is_time_synced = is_clock_set();
+    unsigned long radio_start = millis();
+
+    if (refresh_any && connect_to_wifi()) {
+        unsigned long association_ms = millis() - radio_start;
+        unsigned long fetch_start = millis();
+        start_clock_sync();
+        bool weather_allowed = circuit_allows_wake(weather_request, refresh_weather);
+        bool aq_allowed = circuit_allows_wake(airquality_request, refresh_aq);
+
+        // current location first, the others reuse the association and the resolved hosts
+        for (int i = 0; i < location_cnt; i++) {
+            int loc = (curr_loc + i) % location_cnt;
+            unsigned long location_start = millis();
+            fetch_location(loc, weather_allowed && refresh_weather[loc], refresh_daily[loc], aq_allowed && refresh_aq[loc],
+                is_weather_fetched[loc], is_aq_fetched[loc]);
+            Serial.printf("Location %d fetched in %lu ms\n", loc, millis() - location_start);
+        }
+        if (weather_allowed) {
+            circuit_record_wake(weather_request, refresh_weather, is_weather_fetched);
+        }
+        if (aq_allowed) {
+            circuit_record_wake(airquality_request, refresh_aq, is_aq_fetched);
+        }
+        Serial.printf("Radio session: association %lu ms, %d locations fetched in %lu ms\n",
+            association_ms, location_cnt, millis() - fetch_start);
+        is_time_synced = wait_for_clock_sync(CLOCK_SYNC_TIMEOUT_MS);
+        date_wifi_lease(millis() - radio_start);
+    }
+
+    // stored once the clock is synced, cache entries are timestamped
+    for (int loc = 0; loc < location_cnt; loc++) {
+        if (is_weather_fetched[loc]) {
+            if (refresh_daily[loc]) {
+                response_cache.daily_fetched_ts[loc] = time(NULL);
+            } else {
+                cache_merge_daily(loc, fetched_weather[loc]);
+            }
+            cache_store(response_cache.weather[loc], fetched_weather[loc]);
+            record_pressure(loc, fetched_weather[loc]);
+        }
+        if (is_aq_fetched[loc]) {
+            cache_store(response_cache.air_quality[loc], fetched_air_quality[loc]);
+        }
+    }
+
+    // failed endpoints fall back to the last good response, header shows data is not fresh
+    bool has_weather = is_weather_fetched[curr_loc];
+    bool has_aq = is_aq_fetched[curr_loc];
+
+    if (has_weather) {
+        weather_request.response = fetched_weather[curr_loc];
+    } else {
+        has_weather = cache_load(response_cache.weather[curr_loc], weather_request.response, CACHED_RESPONSE_MAX_AGE_MIN);
+    }
+    if (has_aq) {
+        airquality_request.response = fetched_air_quality[curr_loc];
+    } else {
+        has_aq = cache_load(response_cache.air_quality[curr_loc], airquality_request.response, CACHED_RESPONSE_MAX_AGE_MIN);
+    }
+    bool is_weather_current = refresh_weather[curr_loc] ? is_weather_fetched[curr_loc] : has_weather;
+    bool is_aq_current = refresh_aq[curr_loc] ? is_aq_fetched[curr_loc] : has_aq;
+
+    // The driver waits out the seconds long panel refresh in delay(1) steps,
+    // nothing else is left to do meanwhile: radio off and the cpu slowed down
+    disconnect_from_wifi();
+    setCpuFrequencyMhz(REFRESH_CPU_FREQ_MHZ);
+
+    show_weather(has_weather, has_aq, is_time_synced && is_weather_current && is_aq_current);
 
     // deep sleep stuff
-    enable_timed_sleep(SLEEP_INTERVAL_MIN);
+    enable_timed_sleep(next_sleep_interval_min(curr_loc, weather_request.response, has_weather, view.battery_percent));
     begin_deep_sleep();
 }
 
 
 void set_mode(int mode) {
-    preferences.begin(MEMORY_ID, false);
-    preferences.putInt("mode", mode);
-    preferences.end();
+    if (mode == cached_MODE) {
+        return;
+    }
+    cached_MODE = mode;
+    save_app_state();
 }
 
 
@@ -870,15 +1284,9 @@ void set_mode_and_reboot(int mode) {
 }
 
 
-int get_mode(bool cached_mode) {
-    if (cached_mode) {
-        return cached_MODE;
-    }
-    preferences.begin(MEMORY_ID, false);
-    int mode = preferences.getInt("mode", NOT_SET_MODE);
-    cached_MODE = mode;
-    preferences.end();
-    return mode;
+// mode read by restore_app_state
+int get_mode() {
+    return cached_MODE;
 }
 
 
@@ -886,6 +1294,7 @@ void setup() {
     Serial.begin(115200); 
     Serial.println("\n\n=== WEATHER STATION ===");
     init_display();
+    restore_app_state();
 
     if (get_mode() == NOT_SET_MODE) {
         Serial.println("MODE: not set. Initializing mode to CONFIG_MODE.");